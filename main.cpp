@@ -1,10 +1,10 @@
 #include "src/Controller/SDLEngine.hpp"
-#include "src/Model//Dictionary/Dictionary.hpp"
 #include "src/Model/Dictionary/Alphabet.hpp"
-#include "src/Model/WordleModel.hpp"
+#include "src/Model/GameModelFactory.hpp"
 #include <memory>
+#include <string_view>
 
-int main()
+int main(int argc, char *argv[])
 {
 
     const auto LANG = Alphabet::Language::RUSSIAN;
@@ -13,11 +13,21 @@ int main()
     const int WIDTH = 800;
     const int HEIGHT = 800;
 
-    auto dict = std::make_unique<Dictionary>(LANG, WORD_LEN);
-    auto model = std::make_unique<WordleModel>(LANG, std::move(dict), MAX_ATTEMPTS);
-    SDLEngine controller(std::move(model));
+    // "--adversarial" plays without a fixed target, see AdversarialModel
+    const std::string_view ADVERSARIAL_FLAG = "--adversarial";
+    auto mode = GameModelFactory::GameMode::CLASSIC;
+    for (int argNumber = 1; argNumber < argc; ++argNumber)
+    {
+        if (argv[argNumber] == ADVERSARIAL_FLAG)
+        {
+            mode = GameModelFactory::GameMode::ADVERSARIAL;
+        }
+    }
 
-    controller.init("Wordle Game", WIDTH, HEIGHT);
+    SDLEngine controller(GameModelFactory::create(LANG, WORD_LEN, MAX_ATTEMPTS, mode));
+
+    controller.init(mode == GameModelFactory::GameMode::ADVERSARIAL ? "Wordle Game (adversarial)" : "Wordle Game",
+                    WIDTH, HEIGHT);
     controller.runGameLoop();
     return 0;
-}
\ No newline at end of file
+}
@@ -14,10 +14,16 @@ bool SDLCALL InputHandler::handle(void *userdata, SDL_Event *event)
     {
         instance->quitFlag = true;
     }
+    else if (!instance->gameModel->isReady())
+    {
+        // nothing to type into until the dictionary is loaded
+        return false;
+    }
     else if (event->type == SDL_EVENT_TEXT_INPUT)
     {
         std::string str = event->text.text;
-        if (instance->inputedText.size() < instance->gameModel->getGameState().targetWord.size())
+        const GameStateDTO &state = instance->gameModel->getGameState();
+        if (state.currentInputLength < state.targetWordLength)
         {
             instance->inputedText.append(event->text.text);
             instance->gameModel->modifyCurrentInput(instance->inputedText);
@@ -35,8 +41,8 @@ bool SDLCALL InputHandler::handle(void *userdata, SDL_Event *event)
             }
 
             // handle text input
-            if (instance->gameModel->getGameState().currentInputByLetters.size() !=
-                instance->gameModel->getGameState().targetWordByLetters.size())
+            if (instance->gameModel->getGameState().currentInputLength !=
+                instance->gameModel->getGameState().targetWordLength)
             {
                 return false;
             }
@@ -57,6 +63,17 @@ bool SDLCALL InputHandler::handle(void *userdata, SDL_Event *event)
 
             return false;
         }
+        if (event->key.key == SDLK_TAB)
+        {
+            // the hint is stored in the game state and shown by the status line
+            instance->gameModel->requestHint(HINT_TIME_BUDGET);
+            return false;
+        }
+        if (event->key.key == SDLK_F2)
+        {
+            instance->gameModel->setHardMode(!instance->gameModel->isHardMode());
+            return false;
+        }
         if (event->key.key == SDLK_BACKSPACE)
         {
             std::string &text = instance->inputedText;
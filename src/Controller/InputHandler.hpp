@@ -3,10 +3,15 @@
 #include "SDL3/SDL_events.h"
 
 #include "../Model/IGameModel.hpp"
+#include <chrono>
 #include <string>
 
 class InputHandler
 {
+public:
+    // the hint search runs in the background and refines the shown hint until then
+    static constexpr std::chrono::milliseconds HINT_TIME_BUDGET{2000};
+
 private:
     bool quitFlag;
     bool errorFlag;
@@ -3,8 +3,26 @@
 #include "SDL3/SDL_init.h"
 #include "SDL3/SDL_render.h"
 #include "SDL3/SDL_video.h"
+#include <exception>
 #include <memory>
 #include <stdexcept>
+#include <string>
+
+static std::string describeError(const std::exception_ptr &error)
+{
+    try
+    {
+        std::rethrow_exception(error);
+    }
+    catch (const std::exception &e)
+    {
+        return e.what();
+    }
+    catch (...)
+    {
+        return "неизвестная ошибка";
+    }
+}
 
 SDLEngine::SDLEngine(std::unique_ptr<IGameModel> gameModel) : isValid(false),
                                                               inputHandler(nullptr),
@@ -54,6 +72,7 @@ void SDLEngine::runGameLoop()
     Uint64 lastTime = SDL_GetPerformanceCounter();
     int fps = 0;
     int msPerFrame = 0;
+    std::string loadingFailure; // shown instead of the board, the loading error is not thrown through SDL
 
     while (!inputHandler->shouldQuit())
     {
@@ -68,9 +87,26 @@ void SDLEngine::runGameLoop()
         {
         }
 
-        view->render(game->getGameState());
+        if (game->isReady())
+        {
+            // picks up what the background hint search found since the last frame
+            game->getHint();
+            view->render(game->getGameState());
 
-        view->renderDebugInfo(fps, msPerFrame);
+            view->renderDebugInfo(fps, msPerFrame, game->getDictionaryReloadStats());
+        }
+        else if (const std::exception_ptr loadingError = game->getLoadingError())
+        {
+            if (loadingFailure.empty())
+            {
+                loadingFailure = describeError(loadingError);
+            }
+            view->renderLoading(loadingFailure.c_str());
+        }
+        else
+        {
+            view->renderLoading();
+        }
 
         SDL_RenderPresent(renderer.get());
     }
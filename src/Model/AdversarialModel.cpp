@@ -0,0 +1,233 @@
+#include "AdversarialModel.hpp"
+#include "Dictionary/WordIndex.hpp"
+#include "Solver/BatchScorer.hpp"
+#include "Solver/GuessScorer.hpp"
+#include <algorithm>
+#include <span>
+#include <utility>
+
+static_assert(GameStateDTO::MAX_WORD_LENGTH <= GuessScorer::MAX_WORD_LENGTH);
+
+// letters a feedback reveals, a letter in place counts more than any number of present ones
+static int revealedLetters(FeedbackScorer::PatternCode code)
+{
+    int revealed = 0;
+    for (; code != 0; code /= 3)
+    {
+        revealed += static_cast<int>(code % 3) == 2 ? FeedbackScorer::MAX_WORD_LENGTH + 1 : static_cast<int>(code % 3);
+    }
+    return revealed;
+}
+
+AdversarialModel::AdversarialModel(Alphabet::Language alphabetLanguage, WordleModel::DictionaryFactory dictionaryFactory,
+                                   int maxAttempts) : game(alphabetLanguage, std::move(dictionaryFactory), maxAttempts),
+                                                      isGameStarted(false)
+{
+}
+
+AdversarialModel::~AdversarialModel() = default;
+
+void AdversarialModel::resetCandidates()
+{
+    isGameStarted = true;
+    std::shared_ptr<const WordIndex> index = game.getWordIndex();
+    if (!index || index->getAnswerBlocks().empty())
+    {
+        // nothing to split, the wrapped game keeps its own target
+        wordIndex.reset();
+        answersScorer.reset();
+        candidates.clear();
+        return;
+    }
+
+    if (index != wordIndex)
+    {
+        const int wordLength = index->getWordLength();
+        bucketSizes.assign(FeedbackScorer::allCorrect(wordLength) + 1, 0);
+
+        answersScorer.reset();
+        if (BatchScorer::isSupportedLength(wordLength))
+        {
+            std::vector<std::uint8_t> answerLetters;
+            answerLetters.reserve(index->getAnswerBlocks().size() * wordLength);
+            for (std::uint32_t block : index->getAnswerBlocks())
+            {
+                const auto letters = index->getWordLetters().subspan(static_cast<size_t>(block) * wordLength, wordLength);
+                answerLetters.insert(answerLetters.end(), letters.begin(), letters.end());
+            }
+            answersScorer = std::make_unique<BatchScorer>(answerLetters, wordLength);
+        }
+        wordIndex = std::move(index);
+    }
+
+    candidates.assign(wordIndex->getAnswerBlocks().begin(), wordIndex->getAnswerBlocks().end());
+    guessPatterns.reserve(candidates.size());
+    bucketCodes.reserve(std::min(candidates.size(), bucketSizes.size()));
+}
+
+void AdversarialModel::countPattern(size_t candidateNumber, FeedbackScorer::PatternCode code)
+{
+    guessPatterns[candidateNumber] = code;
+    if (bucketSizes[code]++ == 0)
+    {
+        bucketCodes.push_back(code);
+    }
+}
+
+void AdversarialModel::partitionCandidates(std::span<const GameStateDTO::LetterId> guess)
+{
+    guessPatterns.resize(candidates.size());
+    bucketCodes.clear();
+
+    // no answer was ruled out yet, the batch scorer holds exactly the candidates
+    if (answersScorer && candidates.size() == answersScorer->getWordsCount())
+    {
+        const std::span<const std::uint8_t> patterns = answersScorer->scoreAgainstAll(guess);
+        for (size_t i = 0; i < patterns.size(); ++i)
+        {
+            countPattern(i, patterns[i]);
+        }
+        return;
+    }
+
+    const GuessScorer scorer(guess);
+    const auto wordLength = static_cast<size_t>(wordIndex->getWordLength());
+    const std::uint8_t *words = wordIndex->getWordLetters().data();
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+        countPattern(i, scorer.score(words + (candidates[i] * wordLength)));
+    }
+}
+
+FeedbackScorer::PatternCode AdversarialModel::keepLargestBucket()
+{
+    // every pattern that occurred is looked at once, its counter is cleared for the next guess
+    FeedbackScorer::PatternCode keptCode = bucketCodes.front();
+    std::uint32_t keptSize = 0;
+    int keptRevealed = 0;
+    for (FeedbackScorer::PatternCode code : bucketCodes)
+    {
+        const std::uint32_t size = std::exchange(bucketSizes[code], 0);
+        if (size < keptSize)
+        {
+            continue;
+        }
+        const int revealed = revealedLetters(code);
+        if (size > keptSize || revealed < keptRevealed || (revealed == keptRevealed && code < keptCode))
+        {
+            keptCode = code;
+            keptSize = size;
+            keptRevealed = revealed;
+        }
+    }
+
+    size_t keptCount = 0;
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+        if (guessPatterns[i] == keptCode)
+        {
+            candidates[keptCount++] = candidates[i];
+        }
+    }
+    candidates.resize(keptCount);
+    return keptCode;
+}
+
+bool AdversarialModel::isReady()
+{
+    if (!game.isReady())
+    {
+        return false;
+    }
+    if (!isGameStarted)
+    {
+        resetCandidates();
+    }
+    return true;
+}
+
+std::shared_future<void> AdversarialModel::getReadyFuture() const
+{
+    return game.getReadyFuture();
+}
+
+std::exception_ptr AdversarialModel::getLoadingError() const
+{
+    return game.getLoadingError();
+}
+
+void AdversarialModel::startNewGame()
+{
+    game.startNewGame();
+    resetCandidates();
+}
+
+void AdversarialModel::checkInputWord()
+{
+    if (wordIndex)
+    {
+        GameStateDTO &state = game.getGameState();
+        const std::span<const GameStateDTO::LetterId> guess = state.getCurrentInputLetters();
+        partitionCandidates(guess);
+        const FeedbackScorer::PatternCode keptCode = keepLargestBucket();
+
+        // every word of the kept part gives this feedback; the guess itself once it is the answer left
+        const auto wordLength = static_cast<size_t>(wordIndex->getWordLength());
+        const std::span<const GameStateDTO::LetterId> target =
+            keptCode == FeedbackScorer::allCorrect(static_cast<int>(wordLength))
+                ? guess
+                : wordIndex->getWordLetters().subspan(candidates.front() * wordLength, wordLength);
+        std::ranges::copy(target, state.targetWord.begin());
+    }
+    game.checkInputWord();
+}
+
+bool AdversarialModel::isValidInput()
+{
+    return game.isValidInput();
+}
+
+void AdversarialModel::modifyCurrentInput(const std::string &input)
+{
+    game.modifyCurrentInput(input);
+}
+
+bool AdversarialModel::isGameOver() const
+{
+    return game.isGameOver();
+}
+
+bool AdversarialModel::isUserWin() const
+{
+    return game.isUserWin();
+}
+
+GameStateDTO &AdversarialModel::getGameState()
+{
+    return game.getGameState();
+}
+
+void AdversarialModel::setHardMode(bool isEnabled)
+{
+    game.setHardMode(isEnabled);
+}
+
+bool AdversarialModel::isHardMode() const
+{
+    return game.isHardMode();
+}
+
+DictionaryReloadStats AdversarialModel::getDictionaryReloadStats() const
+{
+    return game.getDictionaryReloadStats();
+}
+
+void AdversarialModel::requestHint(std::chrono::milliseconds timeBudget)
+{
+    game.requestHint(timeBudget);
+}
+
+const GameHint &AdversarialModel::getHint()
+{
+    return game.getHint();
+}
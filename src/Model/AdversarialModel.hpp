@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+#include "GameState.hpp"
+#include "IGameModel.hpp"
+#include "Solver/FeedbackScorer.hpp"
+#include "WordleModel.hpp"
+
+class BatchScorer;
+class WordIndex;
+
+// Absurdle-style game: the model does not commit to a target. Every guess splits the answers
+// still possible by the feedback each of them would give, and the largest part stays, ties going
+// to the feedback that reveals fewer letters. The player wins once a single answer is left and
+// guessed. The split is a histogram over pattern codes, so a guess costs one scoring pass over
+// the remaining answers (see GuessScorer); the first guess of a game with words of up to
+// BatchScorer::MAX_WORD_LENGTH letters is scored with SIMD over the whole list.
+// A word of the kept part becomes the target of the wrapped WordleModel, which then scores the
+// guess and keeps the state, the candidates, hard mode and hints exactly as in the classic game.
+// Without a word index the dictionary cannot be split and the game is the classic one.
+class AdversarialModel : public IGameModel
+{
+private:
+    WordleModel game;
+
+    std::shared_ptr<const WordIndex> wordIndex; // snapshot of the game, a reload is taken by the next game
+    std::unique_ptr<BatchScorer> answersScorer;             // every answer of wordIndex, nullptr for long words
+    std::vector<std::uint32_t> candidates;                  // answers consistent with every feedback, word numbers in increasing order
+    std::vector<FeedbackScorer::PatternCode> guessPatterns; // of the guess against candidates[i]
+    std::vector<std::uint32_t> bucketSizes;                 // by pattern code, all zero between guesses
+    std::vector<FeedbackScorer::PatternCode> bucketCodes;   // patterns of the guess that occurred, each once
+    bool isGameStarted;                                     // the candidates were set up once the dictionary loaded
+
+    // every answer of the dictionary's current word list becomes a candidate again
+    void resetCandidates();
+
+    void countPattern(size_t candidateNumber, FeedbackScorer::PatternCode code);
+
+    // patterns of the guess against the candidates and the size of every part
+    void partitionCandidates(std::span<const GameStateDTO::LetterId> guess);
+
+    // pattern of the largest part, the candidates keep only that part
+    FeedbackScorer::PatternCode keepLargestBucket();
+
+public:
+    AdversarialModel(Alphabet::Language alphabetLanguage, WordleModel::DictionaryFactory dictionaryFactory, int maxAttempts);
+
+    bool isReady() override;
+
+    [[nodiscard]] std::shared_future<void> getReadyFuture() const override;
+
+    [[nodiscard]] std::exception_ptr getLoadingError() const override;
+
+    void startNewGame() override;
+
+    void checkInputWord() override;
+
+    bool isValidInput() override;
+
+    void modifyCurrentInput(const std::string &input) override;
+
+    bool isGameOver() const override;
+
+    bool isUserWin() const override;
+
+    [[nodiscard]] GameStateDTO &getGameState() override;
+
+    void setHardMode(bool isEnabled) override;
+
+    bool isHardMode() const override;
+
+    [[nodiscard]] DictionaryReloadStats getDictionaryReloadStats() const override;
+
+    void requestHint(std::chrono::milliseconds timeBudget) override;
+
+    const GameHint &getHint() override;
+
+    ~AdversarialModel();
+
+    AdversarialModel(const AdversarialModel &other) = delete;
+
+    AdversarialModel &operator=(const AdversarialModel &other) = delete;
+};
@@ -0,0 +1,42 @@
+#include "AliasTable.hpp"
+#include <numeric>
+#include <stdexcept>
+
+AliasTable::AliasTable(std::span<const double> weights) : probabilities(weights.size(), 1.0), aliases(weights.size())
+{
+    const double weightsSum = std::accumulate(weights.begin(), weights.end(), 0.0);
+    if (weights.empty() || !(weightsSum > 0.0))
+    {
+        throw std::invalid_argument("AliasTable: weights must have a positive sum");
+    }
+
+    // scaled so that the average column holds exactly 1
+    std::vector<double> scaled(weights.size());
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    for (size_t i = 0; i < weights.size(); ++i)
+    {
+        scaled[i] = weights[i] * static_cast<double>(weights.size()) / weightsSum;
+        aliases[i] = static_cast<std::uint32_t>(i);
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+    }
+
+    // every underfull column is topped up by one overfull column
+    while (!small.empty() && !large.empty())
+    {
+        const std::uint32_t underfull = small.back();
+        small.pop_back();
+        const std::uint32_t overfull = large.back();
+
+        probabilities[underfull] = scaled[underfull];
+        aliases[underfull] = overfull;
+
+        scaled[overfull] -= 1.0 - scaled[underfull];
+        if (scaled[overfull] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(overfull);
+        }
+    }
+    // whatever is left is full up to rounding errors and keeps probability 1
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Walker's alias method: after an O(n) build, every weighted draw costs one column pick
+// and one comparison, independent of the number of items.
+class AliasTable
+{
+private:
+    std::vector<double> probabilities; // chance to keep the picked column instead of its alias
+    std::vector<std::uint32_t> aliases;
+
+public:
+    AliasTable() = default;
+
+    // weights need not be normalized, at least one has to be positive
+    explicit AliasTable(std::span<const double> weights);
+
+    // maps 64 random bits to an item: high half picks the column, low half flips the coin
+    size_t sample(std::uint64_t randomBits) const
+    {
+        const size_t column = static_cast<size_t>(((randomBits >> 32) * probabilities.size()) >> 32);
+        const double coin = static_cast<double>(static_cast<std::uint32_t>(randomBits)) * 0x1p-32;
+        return coin < probabilities[column] ? column : aliases[column];
+    }
+
+    size_t getItemsCount() const { return probabilities.size(); }
+
+    size_t getMemoryUsage() const
+    {
+        return (probabilities.capacity() * sizeof(double)) + (aliases.capacity() * sizeof(std::uint32_t));
+    }
+};
@@ -1,7 +1,9 @@
 #pragma once
 
-#include <map>
+#include "AlphabetTable.hpp"
+#include <array>
 #include <string>
+#include <string_view>
 
 class Alphabet
 {
@@ -13,24 +15,38 @@ public:
     };
 
 private:
-    static inline const std::map<Language, std::string> ALPHABETS{
-        {Language::ENGLISH, "qwertyuiopasdfghjklzxcvbnm"},
-        {Language::RUSSIAN, "йцукенгшщзхъфывапролджэячсмитьбюё"}};
+    // indexed by Language
+    static constexpr std::array<std::string_view, 2> ALPHABETS{
+        "qwertyuiopasdfghjklzxcvbnm",
+        "йцукенгшщзхъфывапролджэячсмитьбюё"};
 
-    static inline const std::map<Language, std::string> LANGUAGE_STRINGS{
-        {Language::ENGLISH, "ENGLISH"},
-        {Language::RUSSIAN, "RUSSIAN"}};
+    static constexpr std::array<std::string_view, 2> LANGUAGE_STRINGS{
+        "ENGLISH",
+        "RUSSIAN"};
+
+    static constexpr std::array<AlphabetTable, 2> TABLES{
+        AlphabetTable(ALPHABETS[0]),
+        AlphabetTable(ALPHABETS[1])};
 
 public:
     Alphabet() = delete;
 
-    static std::string getAlphabet(Language _language)
+    static constexpr std::string_view getAlphabet(Language _language)
     {
-        return ALPHABETS.at(_language);
+        return ALPHABETS[static_cast<size_t>(_language)];
+    }
+
+    static constexpr const AlphabetTable &getTable(Language _language)
+    {
+        return TABLES[static_cast<size_t>(_language)];
     }
 
     static std::string getLanguageString(Language _language)
     {
-        return LANGUAGE_STRINGS.at(_language);
+        return std::string(LANGUAGE_STRINGS[static_cast<size_t>(_language)]);
     }
 };
+
+static_assert(Alphabet::getTable(Alphabet::Language::RUSSIAN).lettersCount == 33);
+static_assert(Alphabet::getTable(Alphabet::Language::RUSSIAN).getUpperUtf8(32) == "Ё");
+static_assert(Alphabet::getTable(Alphabet::Language::ENGLISH).getLetterId(U'q') == 0);
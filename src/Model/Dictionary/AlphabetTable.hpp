@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Utf8.hpp"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+// Letters of one alphabet, built at compile time: dense letter ids in the order of the
+// alphabet string (the keyboard order), the codepoint of every id and its uppercase form,
+// and the way back from a codepoint through a window that starts at the smallest letter.
+struct AlphabetTable
+{
+    static constexpr size_t MAX_LETTERS = 64;
+    static constexpr size_t CODEPOINT_WINDOW = 128; // every letter of an alphabet lies within it
+    static constexpr std::uint8_t INVALID_LETTER = 0xFF;
+
+    size_t lettersCount = 0;
+    char32_t firstCodepoint = 0;
+    std::array<char32_t, MAX_LETTERS> letters{};
+    std::array<char32_t, MAX_LETTERS> upperLetters{};
+    std::array<std::array<char, 4>, MAX_LETTERS> upperUtf8{};
+    std::array<std::uint8_t, MAX_LETTERS> upperUtf8Lengths{};
+    std::array<std::uint8_t, CODEPOINT_WINDOW> letterIds{};          // codepoint - firstCodepoint -> id
+    std::array<std::uint64_t, CODEPOINT_WINDOW / 64> membership{}; // bit per codepoint of the window
+
+    constexpr explicit AlphabetTable(std::string_view utf8Letters)
+    {
+        size_t position = 0;
+        while (position < utf8Letters.size())
+        {
+            if (lettersCount == MAX_LETTERS)
+            {
+                throw std::invalid_argument("alphabet has too many letters");
+            }
+            letters[lettersCount++] = Utf8::decode(utf8Letters, position);
+        }
+
+        firstCodepoint = letters[0];
+        for (size_t id = 1; id < lettersCount; ++id)
+        {
+            firstCodepoint = letters[id] < firstCodepoint ? letters[id] : firstCodepoint;
+        }
+
+        letterIds.fill(INVALID_LETTER);
+        for (size_t id = 0; id < lettersCount; ++id)
+        {
+            const char32_t offset = letters[id] - firstCodepoint;
+            if (offset >= CODEPOINT_WINDOW || contains(letters[id]))
+            {
+                throw std::invalid_argument("alphabet letters do not fit the codepoint window or repeat");
+            }
+            letterIds[offset] = static_cast<std::uint8_t>(id);
+            membership[offset / 64] |= std::uint64_t{1} << (offset % 64);
+
+            upperLetters[id] = toUpper(letters[id]);
+            upperUtf8Lengths[id] = static_cast<std::uint8_t>(Utf8::encode(upperLetters[id], upperUtf8[id]));
+        }
+    }
+
+    // latin and cyrillic letters, others are left as they are
+    static constexpr char32_t toUpper(char32_t codepoint)
+    {
+        if ((codepoint >= U'a' && codepoint <= U'z') || (codepoint >= U'а' && codepoint <= U'я'))
+        {
+            return codepoint - 0x20;
+        }
+        if (codepoint >= U'ѐ' && codepoint <= U'џ')
+        {
+            return codepoint - 0x50;
+        }
+        return codepoint;
+    }
+
+    constexpr bool contains(char32_t codepoint) const
+    {
+        const char32_t offset = codepoint - firstCodepoint; // wraps around below the window
+        return offset < CODEPOINT_WINDOW && ((membership[offset / 64] >> (offset % 64)) & 1U) != 0;
+    }
+
+    constexpr std::uint8_t getLetterId(char32_t codepoint) const
+    {
+        return contains(codepoint) ? letterIds[codepoint - firstCodepoint] : INVALID_LETTER;
+    }
+
+    constexpr char32_t getLetter(std::uint8_t id) const { return letters[id]; }
+
+    constexpr char32_t getUpperLetter(std::uint8_t id) const { return upperLetters[id]; }
+
+    constexpr std::string_view getUpperUtf8(std::uint8_t id) const
+    {
+        return {upperUtf8[id].data(), upperUtf8Lengths[id]};
+    }
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+// Binary dictionary layout produced by the DictionaryCompiler tool:
+//
+//   CompiledDictionaryHeader
+//   uint32_t offsets[wordsCount + 1]  - byte offsets of words inside the words blob
+//   uint32_t index[indexSize]         - open addressing hash table, word number + 1 (0 = empty slot)
+//   char     words[]                  - all words back to back, without separators
+//
+// All sections are aligned to 8 bytes, integers are stored in native byte order.
+struct CompiledDictionaryHeader
+{
+    static constexpr std::array<char, 8> MAGIC = {'W', 'R', 'D', 'L', 'D', 'I', 'C', 'T'};
+    static constexpr std::uint32_t VERSION = 1;
+
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t wordLength;
+    std::uint32_t wordsCount;
+    std::uint32_t indexSize; // power of two
+    std::uint64_t offsetsPosition;
+    std::uint64_t indexPosition;
+    std::uint64_t wordsPosition;
+    std::uint64_t wordsSize;
+};
+
+class CompiledDictionaryFormat
+{
+public:
+    CompiledDictionaryFormat() = delete;
+
+    static constexpr std::uint32_t EMPTY_SLOT = 0;
+
+    // FNV-1a, same function is used by the compiler and by the reader
+    static constexpr std::uint64_t hash(std::string_view word)
+    {
+        std::uint64_t hashValue = 14695981039346656037ULL;
+        for (char chr : word)
+        {
+            hashValue ^= static_cast<unsigned char>(chr);
+            hashValue *= 1099511628211ULL;
+        }
+        return hashValue;
+    }
+
+    // keeps load factor of the index at most 1/2
+    static constexpr std::uint32_t indexSizeFor(std::uint32_t wordsCount)
+    {
+        std::uint32_t size = 1;
+        while (size < wordsCount * 2)
+        {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    static constexpr std::uint64_t align(std::uint64_t position)
+    {
+        return (position + 7) & ~std::uint64_t{7};
+    }
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+// Counter-based generator: the n-th output is a SplitMix64 hash of (key, n), so any position
+// is reachable in O(1) and streams split from one seed never overlap.
+// Satisfies UniformRandomBitGenerator, usable with <random> distributions.
+class CounterRng
+{
+public:
+    using result_type = std::uint64_t;
+
+private:
+    static constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+    std::uint64_t key;
+    std::uint64_t counter;
+
+    static constexpr std::uint64_t mix(std::uint64_t value)
+    {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+public:
+    explicit constexpr CounterRng(std::uint64_t seed = 0, std::uint64_t stream = 0)
+        : key(mix(seed + GOLDEN_GAMMA) ^ mix(mix(stream) + GOLDEN_GAMMA)), counter(0)
+    {
+    }
+
+    static constexpr result_type min() { return 0; }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() { return at(counter++); }
+
+    // output at any position, does not move the counter
+    constexpr result_type at(std::uint64_t position) const { return mix(key + ((position + 1) * GOLDEN_GAMMA)); }
+
+    // unbiased integer in [0, bound), outputs below 2^64 mod bound are rejected
+    constexpr std::uint64_t below(std::uint64_t bound)
+    {
+        const std::uint64_t threshold = (0 - bound) % bound;
+        for (;;)
+        {
+            const std::uint64_t value = (*this)();
+            if (value >= threshold)
+            {
+                return value % bound;
+            }
+        }
+    }
+
+    // independent generator for one parallel worker, reproducible from the same seed and stream
+    constexpr CounterRng split(std::uint64_t stream) const
+    {
+        CounterRng child;
+        child.key = mix(key ^ mix(stream + GOLDEN_GAMMA));
+        return child;
+    }
+
+    constexpr void discard(std::uint64_t count) { counter += count; }
+
+    constexpr std::uint64_t getCounter() const { return counter; }
+};
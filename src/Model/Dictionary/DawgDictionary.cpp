@@ -0,0 +1,355 @@
+#include "DawgDictionary.hpp"
+#include "Alphabet.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+    struct BuildNode
+    {
+        bool isFinal = false;
+        std::vector<std::pair<std::uint8_t, std::uint32_t>> edges;
+    };
+
+    std::string nodeSignature(const BuildNode &node)
+    {
+        std::string signature(1, node.isFinal ? '1' : '0');
+        for (const auto &[label, target] : node.edges)
+        {
+            signature += static_cast<char>(label);
+            signature.append(reinterpret_cast<const char *>(&target), sizeof(target));
+        }
+        return signature;
+    }
+}
+
+DawgDictionary::DawgDictionary(Alphabet::Language lang, int wordLength)
+    : language(lang), activeWordLength(0), letterCodec(lang),
+      rndGenerator(std::random_device{}())
+{
+    std::vector<std::vector<std::uint8_t>> sequences;
+    Labels labels{};
+
+    for (int length = MIN_WORD_LENGTH; length <= MAX_WORD_LENGTH; ++length)
+    {
+        std::ifstream dictionaryFile(DATA_DIR "/dictionaries/" + Alphabet::getLanguageString(lang) +
+                                     std::format("_DICTIONARY_{}L.txt", length));
+        if (!dictionaryFile.is_open())
+        {
+            continue;
+        }
+
+        std::string word;
+        while (std::getline(dictionaryFile, word))
+        {
+            if (!word.empty() && word.back() == '\r')
+            {
+                word.pop_back();
+            }
+            if (toLabels(word, labels) != length)
+            {
+                continue;
+            }
+            std::vector<std::uint8_t> &sequence = sequences.emplace_back();
+            sequence.reserve(length + 1);
+            sequence.push_back(static_cast<std::uint8_t>(LENGTH_LABEL_BASE + length));
+            sequence.insert(sequence.end(), labels.begin(), labels.begin() + length);
+        }
+    }
+
+    if (sequences.empty())
+    {
+        throw std::runtime_error("Не удалось открыть файл словаря!");
+    }
+
+    std::ranges::sort(sequences);
+    sequences.erase(std::ranges::unique(sequences).begin(), sequences.end());
+    build(sequences);
+
+    setLanguageAndWordLength(lang, wordLength);
+}
+
+void DawgDictionary::build(const std::vector<std::vector<std::uint8_t>> &sortedSequences)
+{
+    // incremental construction of a minimal automaton from sorted input (Daciuk et al.)
+    std::vector<BuildNode> buildNodes(1);
+    std::unordered_map<std::string, std::uint32_t> registry;
+    std::vector<std::uint32_t> path = {0};
+    const std::vector<std::uint8_t> *previous = nullptr;
+
+    // nodes deeper than depth are complete, replace them by already registered equivalents
+    auto minimize = [&](size_t depth)
+    {
+        while (path.size() - 1 > depth)
+        {
+            const std::uint32_t child = path.back();
+            path.pop_back();
+            auto [registered, isInserted] = registry.try_emplace(nodeSignature(buildNodes[child]), child);
+            if (!isInserted)
+            {
+                buildNodes[path.back()].edges.back().second = registered->second;
+            }
+        }
+    };
+
+    for (const auto &sequence : sortedSequences)
+    {
+        size_t commonPrefix = 0;
+        if (previous != nullptr)
+        {
+            auto [sequenceEnd, previousEnd] = std::ranges::mismatch(sequence, *previous);
+            commonPrefix = sequenceEnd - sequence.begin();
+        }
+        minimize(commonPrefix);
+
+        for (size_t i = commonPrefix; i < sequence.size(); ++i)
+        {
+            const auto newNode = static_cast<std::uint32_t>(buildNodes.size());
+            buildNodes.emplace_back();
+            buildNodes[path.back()].edges.emplace_back(sequence[i], newNode);
+            path.push_back(newNode);
+        }
+        buildNodes[path.back()].isFinal = true;
+        previous = &sequence;
+    }
+    minimize(0);
+
+    // compact reachable nodes into flat arrays in reverse postorder, so parents precede children
+    std::vector<bool> isVisited(buildNodes.size(), false);
+    std::vector<std::uint32_t> order;
+    std::function<void(std::uint32_t)> visit = [&](std::uint32_t node)
+    {
+        isVisited[node] = true;
+        for (const auto &[label, target] : buildNodes[node].edges)
+        {
+            if (!isVisited[target])
+            {
+                visit(target);
+            }
+        }
+        order.push_back(node);
+    };
+    visit(0);
+    std::ranges::reverse(order);
+
+    std::vector<std::uint32_t> newIds(buildNodes.size(), NO_NODE);
+    for (size_t newId = 0; newId < order.size(); ++newId)
+    {
+        newIds[order[newId]] = static_cast<std::uint32_t>(newId);
+    }
+
+    nodeFirstEdge.assign(order.size() + 1, 0);
+    nodeWordsCount.assign(order.size(), 0);
+    nodeIsFinal.assign(order.size(), false);
+    edgeLabels.clear();
+    edgeTargets.clear();
+
+    for (size_t newId = 0; newId < order.size(); ++newId)
+    {
+        const BuildNode &node = buildNodes[order[newId]];
+        nodeFirstEdge[newId] = static_cast<std::uint32_t>(edgeLabels.size());
+        nodeIsFinal[newId] = node.isFinal;
+        for (const auto &[label, target] : node.edges)
+        {
+            edgeLabels.push_back(label);
+            edgeTargets.push_back(newIds[target]);
+        }
+    }
+    nodeFirstEdge[order.size()] = static_cast<std::uint32_t>(edgeLabels.size());
+
+    // reverse pass sees every child before its parents
+    for (size_t node = order.size(); node-- > 0;)
+    {
+        std::uint32_t count = nodeIsFinal[node] ? 1 : 0;
+        for (std::uint32_t edge = nodeFirstEdge[node]; edge < nodeFirstEdge[node + 1]; ++edge)
+        {
+            count += nodeWordsCount[edgeTargets[edge]];
+        }
+        nodeWordsCount[node] = count;
+    }
+}
+
+int DawgDictionary::toLabels(std::string_view word, Labels &labels) const
+{
+    int labelsCount = 0;
+    size_t position = 0;
+    while (position < word.size())
+    {
+        std::uint8_t letterIndex = letterCodec.getLetterIndex(LetterCodec::decodeUtf8(word, position));
+        if (letterIndex == LetterCodec::INVALID_LETTER || labelsCount == static_cast<int>(labels.size()))
+        {
+            return -1;
+        }
+        labels[labelsCount++] = letterIndex;
+    }
+    return labelsCount;
+}
+
+std::uint32_t DawgDictionary::findChild(std::uint32_t node, std::uint8_t label) const
+{
+    // build() appends the edges of a node in the order of the sorted sequences
+    const auto first = edgeLabels.begin() + nodeFirstEdge[node];
+    const auto last = edgeLabels.begin() + nodeFirstEdge[node + 1];
+    const auto edge = std::lower_bound(first, last, label);
+    return edge != last && *edge == label ? edgeTargets[edge - edgeLabels.begin()] : NO_NODE;
+}
+
+std::uint32_t DawgDictionary::walk(std::uint32_t node, std::span<const std::uint8_t> labels) const
+{
+    for (std::uint8_t label : labels)
+    {
+        if (node == NO_NODE)
+        {
+            break;
+        }
+        node = findChild(node, label);
+    }
+    return node;
+}
+
+void DawgDictionary::collectWords(std::uint32_t node, std::string &prefix, std::vector<std::string> &output, size_t limit) const
+{
+    if (output.size() >= limit)
+    {
+        return;
+    }
+    if (nodeIsFinal[node])
+    {
+        output.push_back(prefix);
+    }
+
+    const size_t prefixSize = prefix.size();
+    for (std::uint32_t edge = nodeFirstEdge[node]; edge < nodeFirstEdge[node + 1]; ++edge)
+    {
+        LetterCodec::appendUtf8(prefix, letterCodec.getLetter(edgeLabels[edge]));
+        collectWords(edgeTargets[edge], prefix, output, limit);
+        prefix.resize(prefixSize);
+    }
+}
+
+std::string DawgDictionary::getRandomWord()
+{
+    std::uint32_t node = findChild(0, static_cast<std::uint8_t>(LENGTH_LABEL_BASE + activeWordLength));
+    std::uniform_int_distribution<std::uint32_t> randomRank(0, nodeWordsCount[node] - 1);
+    std::uint32_t rank = randomRank(rndGenerator);
+
+    // descend into the child whose subtree holds the rank-th word
+    std::string word;
+    while (!nodeIsFinal[node] || rank != 0)
+    {
+        if (nodeIsFinal[node])
+        {
+            rank--;
+        }
+        for (std::uint32_t edge = nodeFirstEdge[node]; edge < nodeFirstEdge[node + 1]; ++edge)
+        {
+            const std::uint32_t childCount = nodeWordsCount[edgeTargets[edge]];
+            if (rank < childCount)
+            {
+                LetterCodec::appendUtf8(word, letterCodec.getLetter(edgeLabels[edge]));
+                node = edgeTargets[edge];
+                break;
+            }
+            rank -= childCount;
+        }
+    }
+    return word;
+}
+
+bool DawgDictionary::isValidWord(const std::string &inputWord)
+{
+    Labels labels{};
+    const int labelsCount = toLabels(inputWord, labels);
+    if (labelsCount != activeWordLength)
+    {
+        return false;
+    }
+    std::uint32_t node = walk(findChild(0, static_cast<std::uint8_t>(LENGTH_LABEL_BASE + activeWordLength)),
+                              std::span(labels).first(labelsCount));
+    return node != NO_NODE && nodeIsFinal[node];
+}
+
+void DawgDictionary::setLanguageAndWordLength(Alphabet::Language lang, int wordLength)
+{
+    if (lang != language)
+    {
+        *this = DawgDictionary(lang, wordLength);
+        return;
+    }
+    if (getWordsCount(wordLength) == 0)
+    {
+        throw std::runtime_error(std::format("В словаре нет слов длины {}!", wordLength));
+    }
+    activeWordLength = wordLength;
+}
+
+size_t DawgDictionary::countWithPrefix(std::string_view prefix) const
+{
+    Labels labels{};
+    const int labelsCount = toLabels(prefix, labels);
+    if (labelsCount < 0)
+    {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (int length = std::max(MIN_WORD_LENGTH, labelsCount); length <= MAX_WORD_LENGTH; ++length)
+    {
+        std::uint32_t node = walk(findChild(0, static_cast<std::uint8_t>(LENGTH_LABEL_BASE + length)),
+                                  std::span(labels).first(labelsCount));
+        if (node != NO_NODE)
+        {
+            count += nodeWordsCount[node];
+        }
+    }
+    return count;
+}
+
+std::vector<std::string> DawgDictionary::enumeratePrefix(std::string_view prefix, size_t limit) const
+{
+    std::vector<std::string> output;
+    Labels labels{};
+    const int labelsCount = toLabels(prefix, labels);
+    if (labelsCount < 0)
+    {
+        return output;
+    }
+
+    std::string word(prefix);
+    for (int length = std::max(MIN_WORD_LENGTH, labelsCount); length <= MAX_WORD_LENGTH; ++length)
+    {
+        std::uint32_t node = walk(findChild(0, static_cast<std::uint8_t>(LENGTH_LABEL_BASE + length)),
+                                  std::span(labels).first(labelsCount));
+        if (node != NO_NODE)
+        {
+            collectWords(node, word, output, limit);
+        }
+    }
+    return output;
+}
+
+size_t DawgDictionary::getWordsCount(int wordLength) const
+{
+    if (wordLength < MIN_WORD_LENGTH || wordLength > MAX_WORD_LENGTH)
+    {
+        return 0;
+    }
+    std::uint32_t node = findChild(0, static_cast<std::uint8_t>(LENGTH_LABEL_BASE + wordLength));
+    return node == NO_NODE ? 0 : nodeWordsCount[node];
+}
+
+size_t DawgDictionary::getMemoryUsage() const
+{
+    return (nodeFirstEdge.capacity() * sizeof(std::uint32_t)) +
+           (nodeWordsCount.capacity() * sizeof(std::uint32_t)) +
+           (nodeIsFinal.capacity() / 8) +
+           edgeLabels.capacity() +
+           (edgeTargets.capacity() * sizeof(std::uint32_t));
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "IDictionary.hpp"
+#include "LetterCodec.hpp"
+
+// All word lengths of one language in a single minimized DAWG.
+// Every word is stored as [length label, letter indices...], so words of one length
+// share a subtree under the root while common suffixes are shared between all lengths.
+class DawgDictionary : public IDictionary
+{
+public:
+    static constexpr int MIN_WORD_LENGTH = 4;
+    static constexpr int MAX_WORD_LENGTH = 12;
+
+private:
+    static constexpr std::uint8_t LENGTH_LABEL_BASE = 0x80;
+    static constexpr std::uint32_t NO_NODE = ~std::uint32_t{0};
+
+    // one more than the longest word, so a longer input is told apart without a heap buffer
+    using Labels = std::array<std::uint8_t, MAX_WORD_LENGTH + 1>;
+
+    Alphabet::Language language;
+    int activeWordLength;
+    LetterCodec letterCodec;
+
+    // node i owns edges [nodeFirstEdge[i], nodeFirstEdge[i + 1])
+    std::vector<std::uint32_t> nodeFirstEdge;
+    std::vector<std::uint32_t> nodeWordsCount; // words accepted in the subtree of the node
+    std::vector<bool> nodeIsFinal;
+    std::vector<std::uint8_t> edgeLabels;
+    std::vector<std::uint32_t> edgeTargets;
+
+    std::mt19937 rndGenerator;
+
+    void build(const std::vector<std::vector<std::uint8_t>> &sortedSequences);
+
+    // edges of a node are sorted by label, found by binary search
+    std::uint32_t findChild(std::uint32_t node, std::uint8_t label) const;
+
+    // number of letter indices of the word written to labels, -1 if a letter is outside of the
+    // alphabet or the word does not fit
+    int toLabels(std::string_view word, Labels &labels) const;
+
+    std::uint32_t walk(std::uint32_t node, std::span<const std::uint8_t> labels) const;
+
+    void collectWords(std::uint32_t node, std::string &prefix, std::vector<std::string> &output, size_t limit) const;
+
+public:
+    explicit DawgDictionary(Alphabet::Language lang, int wordLength = 5);
+
+    std::string getRandomWord() override;
+
+    bool isValidWord(const std::string &) override;
+
+    // switching length inside one language does not touch the structure
+    void setLanguageAndWordLength(Alphabet::Language lang, int wordLength) override;
+
+    // words of any stored length starting with prefix
+    size_t countWithPrefix(std::string_view prefix) const;
+
+    std::vector<std::string> enumeratePrefix(std::string_view prefix, size_t limit = SIZE_MAX) const;
+
+    size_t getWordsCount(int wordLength) const;
+
+    size_t getNodesCount() const { return nodeIsFinal.size(); }
+
+    size_t getMemoryUsage() const;
+};
@@ -1,134 +1,333 @@
 #include "Dictionary.hpp"
 #include "Alphabet.hpp"
+#include <chrono>
 #include <filesystem>
 #include <format>
-#include <fstream>
+#include <numeric>
 #include <random>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
-Dictionary::Dictionary(Alphabet::Language lang, int wordLength) : pathToDictionary(DATA_DIR "/dictionaries/" +
-                                                                                   Alphabet::getLanguageString(lang) +
-                                                                                   std::format("_DICTIONARY_{}L.txt", wordLength)),
-                                                                  dictionaryFile(pathToDictionary), amountOfWords(0)
+Dictionary::Dictionary(Alphabet::Language lang, int _wordLength) : Dictionary(getListPaths(lang, _wordLength), lang, _wordLength)
 {
-    std::string tempString;
+}
+
+Dictionary::Dictionary(WordListPaths paths, Alphabet::Language lang, int _wordLength) : listPaths(std::move(paths)),
+                                                                                        language(lang), wordLength(_wordLength),
+                                                                                        seed(std::random_device{}()), dailySeed(DEFAULT_DAILY_SEED), rng(seed), drawMode(DrawMode::WEIGHTED),
+                                                                                        wordIndex(std::make_shared<const WordIndex>(listPaths, lang, _wordLength)),
+                                                                                        reloadsCount(0), lastRebuildMs(0.0), lastSwapUs(0.0)
+{
+}
+
+Dictionary::Dictionary(std::shared_ptr<const WordIndex> index, Alphabet::Language lang) : language(lang), wordLength(index->getWordLength()),
+                                                                                       seed(std::random_device{}()), dailySeed(DEFAULT_DAILY_SEED), rng(seed), drawMode(DrawMode::WEIGHTED),
+                                                                                       wordIndex(std::move(index)),
+                                                                                       reloadsCount(0), lastRebuildMs(0.0), lastSwapUs(0.0)
+{
+}
+
+WordListPaths Dictionary::getListPaths(Alphabet::Language lang, int wordLength)
+{
+    const std::string pathPrefix = DATA_DIR "/dictionaries/" + Alphabet::getLanguageString(lang);
+    return WordListPaths{pathPrefix + std::format("_DICTIONARY_{}L.txt", wordLength),
+                         pathPrefix + std::format("_ANSWERS_{}L.txt", wordLength),
+                         pathPrefix + std::format("_FREQUENCY_{}L.txt", wordLength)};
+}
+
+void Dictionary::containsKeys(std::span<const std::uint64_t> keys, std::span<bool> results) const
+{
+    getWordIndex()->containsKeys(keys, results);
+}
 
-    if (dictionaryFile.is_open())
+void Dictionary::areValidWords(std::span<const std::string_view> candidates, std::span<bool> results) const
+{
+    getWordIndex()->areValidWords(candidates, results);
+}
+
+std::string Dictionary::getRandomWord()
+{
+    // drawn and pinned under one lock, so a reload cannot publish an index without it in between
+    std::lock_guard lock(drawMutex);
+    auto index = wordIndex.load();
+
+    switch (drawMode)
     {
-        while (std::getline(dictionaryFile, tempString))
-        {
-            amountOfWords++;
-        }
-        dictionaryFile.close();
-    }
-    else
+    case DrawMode::SHUFFLE_BAG:
+        pinnedWord = std::string(index->getAnswer(drawFromShuffleBag(index)));
+        break;
+    case DrawMode::DAILY:
     {
-        throw std::runtime_error("Не удалось открыть файл словаря!");
+        const auto today = std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now());
+        pinnedWord = std::string(index->getAnswer(getDailyAnswerNumber(*index, today)));
+        break;
     }
+    case DrawMode::WEIGHTED:
+    default:
+        pinnedWord = std::string(index->sampleAnswer(rng()));
+        break;
+    }
+    return pinnedWord;
 }
 
-std::string Dictionary::getRandomWord()
+size_t Dictionary::drawFromShuffleBag(const std::shared_ptr<const WordIndex> &index)
 {
-    std::random_device rndSeed;
-    std::mt19937 rndGenerator(rndSeed());
-
-    std::uniform_int_distribution<> randomIntNumber(0, amountOfWords);
+    // a reload changes the answers, the bag then starts over
+    if (index != bagSource)
+    {
+        bagSource = index;
+        shuffleBag.clear();
+    }
+    if (shuffleBag.empty())
+    {
+        shuffleBag.resize(index->getAnswersCount());
+        std::iota(shuffleBag.begin(), shuffleBag.end(), 0U);
+    }
 
-    int currentLine = 0;
-    int chosenLine = randomIntNumber(rndGenerator);
-    std::string chosenWord;
+    // one Fisher-Yates step per draw, the bag is shuffled lazily
+    const size_t picked = rng.below(shuffleBag.size());
+    std::swap(shuffleBag[picked], shuffleBag.back());
+    const std::uint32_t answerNumber = shuffleBag.back();
+    shuffleBag.pop_back();
+    return answerNumber;
+}
 
-    dictionaryFile.open(pathToDictionary);
+size_t Dictionary::getDailyAnswerNumber(const WordIndex &index, std::chrono::sys_days day) const
+{
+    constexpr std::uint64_t DAILY_STREAM = 0x6461696C79; // "daily"
 
-    if (dictionaryFile.is_open())
+    const std::uint64_t answersCount = index.getAnswersCount();
+    if (answersCount == 1)
     {
-        while (std::getline(dictionaryFile, chosenWord))
-        {
-            if (currentLine == chosenLine)
-            {
-                break;
-            }
-            currentLine++;
-        }
-        dictionaryFile.close();
+        return 0;
     }
-    else
+
+    // day -> (step * day + offset) mod count visits every answer once per cycle,
+    // step is coprime to the count and both depend only on the daily seed
+    const CounterRng dailyRng(dailySeed, DAILY_STREAM);
+    std::uint64_t step = 1 + (dailyRng.at(0) % (answersCount - 1));
+    while (std::gcd(step, answersCount) != 1)
     {
-        throw std::runtime_error("Не удалось открыть файл словаря!");
+        step = 1 + (step % (answersCount - 1));
     }
+    const std::uint64_t offset = dailyRng.at(1) % answersCount;
+
+    const std::int64_t dayNumber = day.time_since_epoch().count();
+    const auto signedCount = static_cast<std::int64_t>(answersCount);
+    const auto dayInCycle = static_cast<std::uint64_t>(((dayNumber % signedCount) + signedCount) % signedCount);
+    return static_cast<size_t>(((step * dayInCycle) + offset) % answersCount);
+}
+
+std::string Dictionary::getDailyWord(std::chrono::sys_days day) const
+{
+    auto index = wordIndex.load();
+    return std::string(index->getAnswer(getDailyAnswerNumber(*index, day)));
+}
+
+std::string Dictionary::drawAnswer(CounterRng &streamRng) const
+{
+    return std::string(wordIndex.load()->sampleAnswer(streamRng()));
+}
+
+void Dictionary::setDailySeed(std::uint64_t newDailySeed)
+{
+    std::lock_guard lock(drawMutex);
+    dailySeed = newDailySeed;
+}
+
+void Dictionary::setSeed(std::uint64_t newSeed)
+{
+    std::lock_guard lock(drawMutex);
+    seed = newSeed;
+    rng = CounterRng(newSeed);
+    bagSource.reset();
+    shuffleBag.clear();
+}
 
-    return chosenWord;
+void Dictionary::setDrawMode(DrawMode newDrawMode)
+{
+    std::lock_guard lock(drawMutex);
+    drawMode = newDrawMode;
 }
 
 bool Dictionary::isValidWord(const std::string &inputWord)
 {
-    std::string currentWord;
-    dictionaryFile.open(pathToDictionary);
-    if (dictionaryFile.is_open())
-    {
-        while (std::getline(dictionaryFile, currentWord))
-        {
-            if (currentWord == inputWord)
-            {
-                dictionaryFile.close();
-                return true;
-            }
-        }
-        dictionaryFile.close();
-    }
-    else
+    return wordIndex.load()->containsWord(inputWord);
+}
+
+std::vector<std::string> Dictionary::getSuggestions(const std::string &inputWord, size_t maxCount)
+{
+    // the snapshot keeps the views alive until they are copied
+    auto index = wordIndex.load();
+    std::vector<std::string> suggestions;
+    for (std::string_view suggestion : index->findClosestWords(inputWord, maxCount, MAX_SUGGESTION_DISTANCE))
     {
-        throw std::runtime_error("Не удалось открыть файл словаря!");
+        suggestions.emplace_back(suggestion);
     }
-    return false;
+    return suggestions;
+}
+
+void Dictionary::setLanguageAndWordLength(Alphabet::Language lang, int newWordLength)
+{
+    std::lock_guard lock(reloadMutex);
+
+    WordListPaths newPaths = getListPaths(lang, newWordLength);
+    auto newIndex = std::make_shared<const WordIndex>(newPaths, lang, newWordLength);
+
+    listPaths = std::move(newPaths);
+    language = lang;
+    wordLength = newWordLength;
+
+    std::lock_guard pinnedLock(drawMutex);
+    pinnedWord.clear();
+    wordIndex.store(std::move(newIndex));
 }
 
-void Dictionary::setLanguageAndWordLength(Alphabet::Language lang, int wordLength)
+void Dictionary::reload()
 {
-    pathToDictionary = DATA_DIR "/" + Alphabet::getLanguageString(lang) + std::format("_DICTIONARY_{}L.txt", wordLength);
-    amountOfWords = 0;
-    std::string tempString;
+    std::lock_guard lock(reloadMutex);
 
-    dictionaryFile.open(pathToDictionary);
+    const auto rebuildStart = std::chrono::steady_clock::now();
 
-    if (dictionaryFile.is_open())
+    std::string wordToKeep;
     {
-        while (std::getline(dictionaryFile, tempString))
+        std::lock_guard pinnedLock(drawMutex);
+        wordToKeep = pinnedWord;
+    }
+
+    for (;;)
+    {
+        auto newIndex = std::make_shared<const WordIndex>(listPaths, language, wordLength);
+        if (!wordToKeep.empty() && !newIndex->containsWord(wordToKeep))
+        {
+            // the current target was removed from the file, the game still has to accept it
+            newIndex = std::make_shared<const WordIndex>(listPaths, language, wordLength,
+                                                         std::span<const std::string>(&wordToKeep, 1));
+        }
+
+        std::unique_lock pinnedLock(drawMutex);
+        if (pinnedWord != wordToKeep && !newIndex->containsWord(pinnedWord))
         {
-            amountOfWords++;
+            // a new target was drawn from the old index meanwhile
+            wordToKeep = pinnedWord;
+            continue;
         }
-        dictionaryFile.close();
+
+        const auto swapStart = std::chrono::steady_clock::now();
+        auto previousIndex = wordIndex.exchange(std::move(newIndex));
+        const auto swapEnd = std::chrono::steady_clock::now();
+        pinnedLock.unlock();
+
+        lastRebuildMs.store(std::chrono::duration<double, std::milli>(swapStart - rebuildStart).count());
+        lastSwapUs.store(std::chrono::duration<double, std::micro>(swapEnd - swapStart).count());
+        reloadsCount.fetch_add(1);
+        // previousIndex is released here, or later by the last reader still holding it
+        return;
     }
-    else
+}
+
+void Dictionary::onFileChanged(const std::filesystem::path &changedFile)
+{
     {
-        throw std::runtime_error("Не удалось открыть файл словаря!");
+        std::lock_guard lock(reloadMutex);
+        const auto fileName = changedFile.filename();
+        if (fileName != listPaths.allowed.filename() &&
+            fileName != listPaths.answers.filename() &&
+            fileName != listPaths.frequencies.filename())
+        {
+            return;
+        }
+    }
+
+    try
+    {
+        reload();
+    }
+    catch (const std::exception &)
+    {
+        // the file may be half written or broken, keep serving the previous index
     }
 }
 
-Dictionary::~Dictionary()
+void Dictionary::enableHotReload()
 {
-    if (dictionaryFile.is_open())
+    if (watcher)
     {
-        dictionaryFile.close();
+        return;
     }
+
+    std::filesystem::path dictionariesDir;
+    {
+        std::lock_guard lock(reloadMutex);
+        dictionariesDir = listPaths.allowed.parent_path();
+    }
+    watcher = std::make_unique<DictionaryWatcher>(dictionariesDir, [this](const std::filesystem::path &changedFile)
+                                                  { onFileChanged(changedFile); });
+}
+
+DictionaryReloadStats Dictionary::getReloadStats() const
+{
+    return DictionaryReloadStats{reloadsCount.load(), lastRebuildMs.load(), lastSwapUs.load()};
 }
 
-Dictionary::Dictionary(Dictionary &&other) noexcept : pathToDictionary(std::move(other.pathToDictionary)),
-                                                      dictionaryFile(std::move(other.dictionaryFile)),
-                                                      amountOfWords(other.amountOfWords)
+Dictionary::~Dictionary() = default;
+
+Dictionary::Dictionary(Dictionary &&other) : language(other.language), wordLength(other.wordLength),
+                                             seed(other.seed), dailySeed(other.dailySeed), rng(other.rng), drawMode(other.drawMode),
+                                             reloadsCount(other.reloadsCount.load()),
+                                             lastRebuildMs(other.lastRebuildMs.load()),
+                                             lastSwapUs(other.lastSwapUs.load())
 {
-    other.amountOfWords = 0;
+    // the watcher calls back into other, so it is restarted for this object
+    const bool isHotReloadEnabled = other.watcher != nullptr;
+    other.watcher.reset();
+
+    listPaths = std::move(other.listPaths);
+    pinnedWord = std::move(other.pinnedWord);
+    bagSource = std::move(other.bagSource);
+    shuffleBag = std::move(other.shuffleBag);
+    wordIndex.store(other.wordIndex.exchange(nullptr));
+
+    if (isHotReloadEnabled)
+    {
+        enableHotReload();
+    }
 }
 
-Dictionary &Dictionary::operator=(Dictionary &&other) noexcept
+Dictionary &Dictionary::operator=(Dictionary &&other)
 {
     if (this != &other)
     {
-        std::swap(pathToDictionary, other.pathToDictionary);
-        std::swap(dictionaryFile, other.dictionaryFile);
+        const bool isHotReloadEnabled = watcher != nullptr;
+        const bool isOtherHotReloadEnabled = other.watcher != nullptr;
+        watcher.reset();
+        other.watcher.reset();
+
+        std::swap(listPaths, other.listPaths);
+        std::swap(language, other.language);
+        std::swap(wordLength, other.wordLength);
+        std::swap(pinnedWord, other.pinnedWord);
+        std::swap(seed, other.seed);
+        std::swap(dailySeed, other.dailySeed);
+        std::swap(rng, other.rng);
+        std::swap(drawMode, other.drawMode);
+        std::swap(bagSource, other.bagSource);
+        std::swap(shuffleBag, other.shuffleBag);
+        other.wordIndex.store(wordIndex.exchange(other.wordIndex.load()));
 
-        amountOfWords = other.amountOfWords;
-        other.amountOfWords = 0;
+        reloadsCount.store(other.reloadsCount.exchange(reloadsCount.load()));
+        lastRebuildMs.store(other.lastRebuildMs.exchange(lastRebuildMs.load()));
+        lastSwapUs.store(other.lastSwapUs.exchange(lastSwapUs.load()));
+
+        if (isOtherHotReloadEnabled)
+        {
+            enableHotReload();
+        }
+        if (isHotReloadEnabled)
+        {
+            other.enableHotReload();
+        }
     }
     return *this;
-}
\ No newline at end of file
+}
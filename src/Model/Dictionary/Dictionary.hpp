@@ -1,36 +1,137 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
-#include <fstream>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <vector>
 
+#include "CounterRng.hpp"
+#include "DictionaryWatcher.hpp"
 #include "IDictionary.hpp"
+#include "LetterCodec.hpp"
+#include "WordIndex.hpp"
 
+// Readers take the current WordIndex without locking. A reload builds a new index aside
+// and publishes it with one atomic store, the old one is freed by its last reader.
 class Dictionary : public IDictionary
 {
+public:
+    static constexpr int MAX_SUGGESTION_DISTANCE = 2;
+    static constexpr std::uint64_t DEFAULT_DAILY_SEED = 0x576F72646C65; // "Wordle", shared by every build
+
+    enum class DrawMode
+    {
+        WEIGHTED,    // by answer frequency, repeats possible
+        SHUFFLE_BAG, // every answer once before any repeats
+        DAILY        // one answer per calendar day, the same for every process with the same daily seed
+    };
+
 private:
-    std::filesystem::path pathToDictionary;
-    std::ifstream dictionaryFile;
-    int amountOfWords;
+    // guards the fields below against a reload running on the watcher thread
+    mutable std::mutex reloadMutex;
+    WordListPaths listPaths;
+    Alphabet::Language language;
+    int wordLength;
+
+    // guards target drawing: the last drawn target, kept valid across reloads, and the generator state
+    std::mutex drawMutex;
+    std::string pinnedWord;
+    std::uint64_t seed;
+    std::uint64_t dailySeed; // independent of seed, so random draws do not move the daily word
+    CounterRng rng;
+    DrawMode drawMode;
+    std::shared_ptr<const WordIndex> bagSource; // snapshot the bag was filled from
+    std::vector<std::uint32_t> shuffleBag;      // answer numbers not drawn yet
+
+    std::atomic<std::shared_ptr<const WordIndex>> wordIndex;
+
+    std::atomic<int> reloadsCount;
+    std::atomic<double> lastRebuildMs;
+    std::atomic<double> lastSwapUs;
+
+    // declared last, so its thread is joined before the fields it touches are destroyed
+    std::unique_ptr<DictionaryWatcher> watcher;
+
+    static WordListPaths getListPaths(Alphabet::Language lang, int wordLength);
+
+    void onFileChanged(const std::filesystem::path &changedFile);
+
+    size_t drawFromShuffleBag(const std::shared_ptr<const WordIndex> &index);
+
+    size_t getDailyAnswerNumber(const WordIndex &index, std::chrono::sys_days day) const;
 
 public:
     Dictionary();
 
     Dictionary(Alphabet::Language lang, int wordLength);
 
+    // word lists from the given files instead of DATA_DIR, e.g. generated ones of a tool
+    Dictionary(WordListPaths paths, Alphabet::Language lang, int wordLength);
+
+    // a word list built elsewhere, e.g. from the embedded words; there is no file to reload
+    Dictionary(std::shared_ptr<const WordIndex> index, Alphabet::Language lang);
+
     std::string getRandomWord() override;
 
     bool isValidWord(const std::string &) override;
 
     void setLanguageAndWordLength(Alphabet::Language lang, int wordLength) override;
 
+    DictionaryReloadStats getReloadStats() const override;
+
+    // words within MAX_SUGGESTION_DISTANCE edits, closest first
+    std::vector<std::string> getSuggestions(const std::string &inputWord, size_t maxCount) override;
+
+    // restarts the generator, the same seed replays the same sequence of targets
+    void setSeed(std::uint64_t newSeed);
+
+    // picks another daily permutation, every process with the same daily seed shows the same word
+    void setDailySeed(std::uint64_t newDailySeed);
+
+    void setDrawMode(DrawMode newDrawMode);
+
+    // a permutation of the answers indexed by day, no repeats within getAnswersCount() days
+    std::string getDailyWord(std::chrono::sys_days day) const;
+
+    // weighted answer from the caller's own stream (see CounterRng::split), safe for parallel simulations
+    std::string drawAnswer(CounterRng &streamRng) const;
+
+    // current snapshot, stays valid for the holder even if a reload replaces it
+    std::shared_ptr<const WordIndex> getWordIndex() const override { return wordIndex.load(); }
+
+    size_t getWordsCount() const { return getWordIndex()->getWordsCount(); }
+
+    // approximate resident size of the loaded word list and its index
+    size_t getMemoryUsage() const { return getWordIndex()->getMemoryUsage(); }
+
+    // rebuilds the index from the file, throws and keeps the old index if the file is broken
+    void reload();
+
+    // reloads automatically whenever the dictionary file changes on disk
+    void enableHotReload();
+
+    bool containsKey(std::uint64_t key) const { return getWordIndex()->containsKey(key); }
+
+    // batch membership, results[i] is set for candidates[i]
+    void containsKeys(std::span<const std::uint64_t> keys, std::span<bool> results) const;
+
+    void areValidWords(std::span<const std::string_view> candidates, std::span<bool> results) const;
+
     ~Dictionary();
 
-    Dictionary(Dictionary &&other) noexcept;
+    // not noexcept: a hot-reloaded dictionary starts a new watcher for the moved-to object, which
+    // throws if the watch cannot be set up; the words have been moved by then
+    Dictionary(Dictionary &&other);
 
-    Dictionary &operator=(Dictionary &&other) noexcept;
+    Dictionary &operator=(Dictionary &&other);
 
     Dictionary(const Dictionary &other) = delete;
 
     Dictionary &operator=(const Dictionary &other) = delete;
-};
\ No newline at end of file
+};
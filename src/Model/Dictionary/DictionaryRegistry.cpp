@@ -0,0 +1,224 @@
+#include "DictionaryRegistry.hpp"
+#include <chrono>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <utility>
+
+DictionaryRegistry::DictionaryRegistry(size_t _memoryBudget, bool _isHotReloadEnabled) : memoryBudget(_memoryBudget), memoryUsage(0),
+                                                                                         isHotReloadEnabled(_isHotReloadEnabled)
+{
+}
+
+DictionaryRegistry::~DictionaryRegistry()
+{
+    std::vector<std::future<void>> runningPreloads;
+    {
+        std::lock_guard lock(registryMutex);
+        runningPreloads.swap(preloads);
+    }
+    // a preload takes registryMutex when it finishes, so it is joined without holding it
+    runningPreloads.clear();
+}
+
+DictionaryRegistry::Loading DictionaryRegistry::findOrStartLoading(const Key &key,
+                                                                   std::promise<std::shared_ptr<Dictionary>> &loadPromise,
+                                                                   bool &isLoader)
+{
+    isLoader = false;
+    auto loading = loadingByKey.find(key);
+    if (loading != loadingByKey.end())
+    {
+        return loading->second;
+    }
+
+    isLoader = true;
+    Loading newLoading = loadPromise.get_future().share();
+    loadingByKey.emplace(key, newLoading);
+    return newLoading;
+}
+
+void DictionaryRegistry::load(const Key &key, std::promise<std::shared_ptr<Dictionary>> loadPromise)
+{
+    std::shared_ptr<Dictionary> dictionary;
+    try
+    {
+        dictionary = std::make_shared<Dictionary>(key.first, key.second);
+        if (isHotReloadEnabled)
+        {
+            dictionary->enableHotReload();
+        }
+    }
+    catch (...)
+    {
+        // the next acquire tries again
+        std::lock_guard lock(registryMutex);
+        loadingByKey.erase(key);
+        loadPromise.set_exception(std::current_exception());
+        return;
+    }
+    const size_t dictionaryMemory = dictionary->getMemoryUsage();
+
+    std::lock_guard lock(registryMutex);
+    loadingByKey.erase(key);
+    if (auto settings = settingsByKey.find(key); settings != settingsByKey.end())
+    {
+        applySettings(settings->second, *dictionary);
+    }
+    entries.push_front(Entry{key, dictionary, dictionaryMemory});
+    entriesByKey[key] = entries.begin();
+    memoryUsage += dictionaryMemory;
+    evict();
+    loadPromise.set_value(std::move(dictionary));
+}
+
+void DictionaryRegistry::applySettings(const DrawSettings &settings, Dictionary &dictionary)
+{
+    if (settings.drawMode)
+    {
+        dictionary.setDrawMode(*settings.drawMode);
+    }
+    if (settings.seed)
+    {
+        dictionary.setSeed(*settings.seed);
+    }
+    if (settings.dailySeed)
+    {
+        dictionary.setDailySeed(*settings.dailySeed);
+    }
+}
+
+template <typename Apply>
+void DictionaryRegistry::updateSettings(const Key &key, Apply apply)
+{
+    std::lock_guard lock(registryMutex);
+    DrawSettings &settings = settingsByKey[key];
+    apply(settings);
+    if (auto found = entriesByKey.find(key); found != entriesByKey.end())
+    {
+        // only the changed setting, so a new draw mode does not restart the generator
+        DrawSettings changed;
+        apply(changed);
+        applySettings(changed, *found->second->dictionary);
+    }
+    // a dictionary being loaded picks the settings up when it becomes resident
+}
+
+void DictionaryRegistry::setDrawMode(Alphabet::Language lang, int wordLength, Dictionary::DrawMode drawMode)
+{
+    updateSettings({lang, wordLength}, [drawMode](DrawSettings &settings)
+                   { settings.drawMode = drawMode; });
+}
+
+void DictionaryRegistry::setSeed(Alphabet::Language lang, int wordLength, std::uint64_t seed)
+{
+    updateSettings({lang, wordLength}, [seed](DrawSettings &settings)
+                   { settings.seed = seed; });
+}
+
+void DictionaryRegistry::setDailySeed(Alphabet::Language lang, int wordLength, std::uint64_t dailySeed)
+{
+    updateSettings({lang, wordLength}, [dailySeed](DrawSettings &settings)
+                   { settings.dailySeed = dailySeed; });
+}
+
+std::shared_ptr<Dictionary> DictionaryRegistry::acquire(Alphabet::Language lang, int wordLength)
+{
+    const Key key{lang, wordLength};
+    std::promise<std::shared_ptr<Dictionary>> loadPromise;
+    bool isLoader = false;
+    Loading loading;
+    {
+        std::lock_guard lock(registryMutex);
+        auto found = entriesByKey.find(key);
+        if (found != entriesByKey.end())
+        {
+            entries.splice(entries.begin(), entries, found->second);
+            // dictionaries released since the last eviction may go now
+            evict();
+            return found->second->dictionary;
+        }
+        loading = findOrStartLoading(key, loadPromise, isLoader);
+    }
+
+    if (isLoader)
+    {
+        load(key, std::move(loadPromise));
+    }
+    return loading.get();
+}
+
+void DictionaryRegistry::preload(Alphabet::Language lang, int wordLength)
+{
+    const Key key{lang, wordLength};
+    std::promise<std::shared_ptr<Dictionary>> loadPromise;
+    bool isLoader = false;
+
+    std::lock_guard lock(registryMutex);
+    std::erase_if(preloads, [](const std::future<void> &preload)
+                  { return preload.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+    if (entriesByKey.contains(key))
+    {
+        return;
+    }
+    findOrStartLoading(key, loadPromise, isLoader);
+    if (isLoader)
+    {
+        preloads.push_back(std::async(std::launch::async, [this, key, loadPromise = std::move(loadPromise)]() mutable
+                                      { load(key, std::move(loadPromise)); }));
+    }
+}
+
+bool DictionaryRegistry::isResident(Alphabet::Language lang, int wordLength) const
+{
+    std::lock_guard lock(registryMutex);
+    return entriesByKey.contains({lang, wordLength});
+}
+
+void DictionaryRegistry::setMemoryBudget(size_t newMemoryBudget)
+{
+    std::lock_guard lock(registryMutex);
+    memoryBudget = newMemoryBudget;
+    evict();
+}
+
+size_t DictionaryRegistry::getMemoryUsage() const
+{
+    std::lock_guard lock(registryMutex);
+    size_t usage = 0;
+    for (const Entry &entry : entries)
+    {
+        usage += entry.dictionary->getMemoryUsage();
+    }
+    return usage;
+}
+
+void DictionaryRegistry::refreshMemoryUsage()
+{
+    memoryUsage = 0;
+    for (Entry &entry : entries)
+    {
+        entry.memoryUsage = entry.dictionary->getMemoryUsage();
+        memoryUsage += entry.memoryUsage;
+    }
+}
+
+void DictionaryRegistry::evict()
+{
+    refreshMemoryUsage();
+
+    // least recently used first; the most recently used entry stays even if it alone is over
+    // budget, and so do the ones held outside the registry, evicting them would free nothing
+    auto entry = entries.end();
+    while (memoryUsage > memoryBudget && entry != entries.begin() && std::prev(entry) != entries.begin())
+    {
+        --entry;
+        if (entry->dictionary.use_count() > 1)
+        {
+            continue;
+        }
+        memoryUsage -= entry->memoryUsage;
+        entriesByKey.erase(entry->key);
+        entry = entries.erase(entry);
+    }
+}
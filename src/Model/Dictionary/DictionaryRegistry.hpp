@@ -0,0 +1,106 @@
+#pragma once
+
+#include <future>
+#include <list>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Alphabet.hpp"
+#include "Dictionary.hpp"
+
+// Loads every (language, word length) dictionary on first use and keeps recently used ones
+// resident while they fit into the memory budget. Least recently used ones are evicted first;
+// a dictionary still held outside the registry is not evicted, its memory is not freed anyway and
+// a later acquire gets the same instance instead of a second copy. Draw settings are kept per
+// dictionary and applied to every instance loaded for it.
+// A dictionary is parsed outside of the registry lock, so lookups of resident dictionaries never
+// wait for a load; callers asking for a dictionary that is being loaded share that one load.
+class DictionaryRegistry
+{
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = size_t{64} * 1024 * 1024;
+
+private:
+    using Key = std::pair<Alphabet::Language, int>;
+    using Loading = std::shared_future<std::shared_ptr<Dictionary>>;
+
+    struct Entry
+    {
+        Key key;
+        std::shared_ptr<Dictionary> dictionary;
+        size_t memoryUsage; // charged to the budget, follows hot reloads
+    };
+
+    struct DrawSettings
+    {
+        std::optional<Dictionary::DrawMode> drawMode;
+        std::optional<std::uint64_t> seed;
+        std::optional<std::uint64_t> dailySeed;
+    };
+
+    mutable std::mutex registryMutex;
+    std::list<Entry> entries; // most recently used first
+    std::map<Key, std::list<Entry>::iterator> entriesByKey;
+    std::map<Key, Loading> loadingByKey; // dictionaries being parsed, not resident yet
+    std::map<Key, DrawSettings> settingsByKey;
+    size_t memoryBudget;
+    size_t memoryUsage;
+    bool isHotReloadEnabled;
+
+    // background loads started by preload(), declared last so they finish before the state above goes away
+    std::vector<std::future<void>> preloads;
+
+    void evict();
+
+    // a hot reload swaps the index, so the charged sizes are read again; called under registryMutex
+    void refreshMemoryUsage();
+
+    // the settings of the key, stored for later loads and applied to the resident instance
+    template <typename Apply>
+    void updateSettings(const Key &key, Apply apply);
+
+    static void applySettings(const DrawSettings &settings, Dictionary &dictionary);
+
+    // the load already running for a dictionary that is not resident, or a new load this caller
+    // has to run (isLoader); called under registryMutex
+    Loading findOrStartLoading(const Key &key, std::promise<std::shared_ptr<Dictionary>> &loadPromise, bool &isLoader);
+
+    // parses the dictionary without holding registryMutex, then makes it resident and fulfils the promise
+    void load(const Key &key, std::promise<std::shared_ptr<Dictionary>> loadPromise);
+
+public:
+    // with hot reload every loaded dictionary follows changes of its file on disk
+    explicit DictionaryRegistry(size_t memoryBudget = DEFAULT_MEMORY_BUDGET, bool isHotReloadEnabled = false);
+
+    // waits only if this dictionary is not resident yet, rethrows its loading error
+    std::shared_ptr<Dictionary> acquire(Alphabet::Language lang, int wordLength);
+
+    // starts loading on a background thread and returns at once, so a later switch is only a
+    // lookup or a wait for the load already under way; loading errors surface in acquire()
+    void preload(Alphabet::Language lang, int wordLength);
+
+    bool isResident(Alphabet::Language lang, int wordLength) const;
+
+    // kept for the dictionary, survive its eviction and apply to the resident instance at once
+    void setDrawMode(Alphabet::Language lang, int wordLength, Dictionary::DrawMode drawMode);
+
+    void setSeed(Alphabet::Language lang, int wordLength, std::uint64_t seed);
+
+    void setDailySeed(Alphabet::Language lang, int wordLength, std::uint64_t dailySeed);
+
+    void setMemoryBudget(size_t newMemoryBudget);
+
+    size_t getMemoryUsage() const;
+
+    // waits for the preloads still running
+    ~DictionaryRegistry();
+
+    DictionaryRegistry(const DictionaryRegistry &other) = delete;
+
+    DictionaryRegistry &operator=(const DictionaryRegistry &other) = delete;
+};
@@ -0,0 +1,114 @@
+#include "DictionaryWatcher.hpp"
+#include <chrono>
+#include <map>
+#include <set>
+#include <system_error>
+#include <utility>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// events are collected until the directory is quiet for one interval,
+// so a file written in several chunks is reported once
+static constexpr int QUIET_INTERVAL_MS = 100;
+static constexpr auto POLL_INTERVAL = std::chrono::milliseconds(500);
+
+static std::map<std::filesystem::path, std::filesystem::file_time_type> scanDirectory(const std::filesystem::path &directory)
+{
+    std::map<std::filesystem::path, std::filesystem::file_time_type> modificationTimes;
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator(directory, error))
+    {
+        std::error_code timeError;
+        auto modificationTime = entry.last_write_time(timeError);
+        if (!timeError)
+        {
+            modificationTimes[entry.path()] = modificationTime;
+        }
+    }
+    return modificationTimes;
+}
+
+static void pollModificationTimes(const std::filesystem::path &directory,
+                                  const DictionaryWatcher::ChangeCallback &onChange,
+                                  std::stop_token stopToken)
+{
+    auto knownTimes = scanDirectory(directory);
+    while (!stopToken.stop_requested())
+    {
+        std::this_thread::sleep_for(POLL_INTERVAL);
+
+        auto currentTimes = scanDirectory(directory);
+        for (const auto &[path, modificationTime] : currentTimes)
+        {
+            auto known = knownTimes.find(path);
+            if (known == knownTimes.end() || known->second != modificationTime)
+            {
+                onChange(path);
+            }
+        }
+        knownTimes = std::move(currentTimes);
+    }
+}
+
+DictionaryWatcher::DictionaryWatcher(std::filesystem::path _directory, ChangeCallback _onChange)
+    : directory(std::move(_directory)), onChange(std::move(_onChange))
+{
+    watchThread = std::jthread([this](std::stop_token stopToken)
+                               { watchLoop(std::move(stopToken)); });
+}
+
+DictionaryWatcher::~DictionaryWatcher()
+{
+    watchThread.request_stop();
+}
+
+void DictionaryWatcher::watchLoop(std::stop_token stopToken)
+{
+#ifdef __linux__
+    const int inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd >= 0 && inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) >= 0)
+    {
+        std::set<std::filesystem::path> changedFiles;
+        alignas(inotify_event) char eventBuffer[4096];
+
+        while (!stopToken.stop_requested())
+        {
+            pollfd pollDescriptor{inotifyFd, POLLIN, 0};
+            if (poll(&pollDescriptor, 1, QUIET_INTERVAL_MS) <= 0)
+            {
+                for (const auto &changedFile : changedFiles)
+                {
+                    onChange(changedFile);
+                }
+                changedFiles.clear();
+                continue;
+            }
+
+            ssize_t bytesRead = 0;
+            while ((bytesRead = read(inotifyFd, eventBuffer, sizeof(eventBuffer))) > 0)
+            {
+                for (ssize_t offset = 0; offset < bytesRead;)
+                {
+                    const auto *event = reinterpret_cast<const inotify_event *>(eventBuffer + offset);
+                    if (event->len > 0)
+                    {
+                        changedFiles.insert(directory / event->name);
+                    }
+                    offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                }
+            }
+        }
+        close(inotifyFd);
+        return;
+    }
+    if (inotifyFd >= 0)
+    {
+        close(inotifyFd);
+    }
+#endif
+    pollModificationTimes(directory, onChange, std::move(stopToken));
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <thread>
+
+// Watches a directory on its own thread and reports files that were rewritten or moved in.
+// Uses inotify on Linux and polls modification times elsewhere.
+class DictionaryWatcher
+{
+public:
+    using ChangeCallback = std::function<void(const std::filesystem::path &changedFile)>;
+
+private:
+    std::filesystem::path directory;
+    ChangeCallback onChange;
+    std::jthread watchThread;
+
+    void watchLoop(std::stop_token stopToken);
+
+public:
+    DictionaryWatcher(std::filesystem::path directory, ChangeCallback onChange);
+
+    // stops and joins the watch thread
+    ~DictionaryWatcher();
+
+    DictionaryWatcher(const DictionaryWatcher &other) = delete;
+
+    DictionaryWatcher &operator=(const DictionaryWatcher &other) = delete;
+};
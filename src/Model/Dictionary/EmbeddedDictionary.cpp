@@ -0,0 +1,91 @@
+#include "EmbeddedDictionary.hpp"
+#include "PerfectHash.hpp"
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef WORDLE_EMBEDDED_DICTIONARIES
+
+// word lists generated by DictionaryCompiler --embed at build time
+#include "EmbeddedDictionaries.inc"
+
+#define WORDLE_EMBEDDED_HASH(LANGUAGE, LENGTH, WORDS) \
+    constexpr auto WORDS##_HASH = PerfectHash::build(WORDS);
+WORDLE_EMBEDDED_WORD_LISTS(WORDLE_EMBEDDED_HASH)
+#undef WORDLE_EMBEDDED_HASH
+
+#define WORDLE_EMBEDDED_ENTRY(LANGUAGE, LENGTH, WORDS) \
+    EmbeddedWordList{Alphabet::Language::LANGUAGE, LENGTH, WORDS, WORDS##_HASH.seeds, WORDS##_HASH.slotWords},
+static constexpr EmbeddedWordList EMBEDDED_WORD_LISTS[] = {WORDLE_EMBEDDED_WORD_LISTS(WORDLE_EMBEDDED_ENTRY)};
+#undef WORDLE_EMBEDDED_ENTRY
+
+#else
+
+static constexpr std::array<EmbeddedWordList, 0> EMBEDDED_WORD_LISTS{};
+
+#endif
+
+const EmbeddedWordList *EmbeddedDictionary::findWordList(Alphabet::Language lang, int wordLength)
+{
+    for (const EmbeddedWordList &embeddedList : EMBEDDED_WORD_LISTS)
+    {
+        if (embeddedList.language == lang && embeddedList.wordLength == wordLength)
+        {
+            return &embeddedList;
+        }
+    }
+    return nullptr;
+}
+
+bool EmbeddedDictionary::isAvailable(Alphabet::Language lang, int wordLength)
+{
+    return findWordList(lang, wordLength) != nullptr;
+}
+
+EmbeddedDictionary::EmbeddedDictionary(Alphabet::Language lang, int wordLength) : wordList(nullptr)
+{
+    setLanguageAndWordLength(lang, wordLength);
+}
+
+std::string EmbeddedDictionary::getRandomWord()
+{
+    return dictionary->getRandomWord();
+}
+
+bool EmbeddedDictionary::isValidWord(const std::string &inputWord)
+{
+    return wordList->words[PerfectHash::lookup(inputWord, wordList->seeds, wordList->slotWords)] == inputWord;
+}
+
+void EmbeddedDictionary::setLanguageAndWordLength(Alphabet::Language lang, int wordLength)
+{
+    const EmbeddedWordList *newWordList = findWordList(lang, wordLength);
+    if (newWordList == nullptr)
+    {
+        throw std::runtime_error("Словарь не встроен в сборку!");
+    }
+
+    auto newDictionary = std::make_unique<Dictionary>(std::make_shared<const WordIndex>(newWordList->words, lang, wordLength), lang);
+    newDictionary->setDrawMode(drawMode);
+    wordList = newWordList;
+    dictionary = std::move(newDictionary);
+}
+
+std::vector<std::string> EmbeddedDictionary::getSuggestions(const std::string &inputWord, size_t maxCount)
+{
+    return dictionary->getSuggestions(inputWord, maxCount);
+}
+
+std::shared_ptr<const WordIndex> EmbeddedDictionary::getWordIndex() const
+{
+    return dictionary->getWordIndex();
+}
+
+void EmbeddedDictionary::setDrawMode(Dictionary::DrawMode newDrawMode)
+{
+    drawMode = newDrawMode;
+    dictionary->setDrawMode(newDrawMode);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Dictionary.hpp"
+#include "IDictionary.hpp"
+
+struct EmbeddedWordList
+{
+    Alphabet::Language language;
+    int wordLength;
+    std::span<const std::string_view> words;
+    std::span<const std::uint32_t> seeds;
+    std::span<const std::uint32_t> slotWords;
+};
+
+// Word lists compiled into the executable (WORDLE_EMBED_DICTIONARIES build option),
+// validation goes through a perfect hash generated at compile time. Everything else comes from a
+// Dictionary over a WordIndex of the same words: targets with its draw modes, suggestions, the word
+// list for candidates and hints. Only the allowed lists are embedded, so every word is an answer
+// and all are equally likely, and there is no hot reload.
+class EmbeddedDictionary : public IDictionary
+{
+private:
+    const EmbeddedWordList *wordList;
+    std::unique_ptr<Dictionary> dictionary;
+    Dictionary::DrawMode drawMode = Dictionary::DrawMode::WEIGHTED;
+
+    static const EmbeddedWordList *findWordList(Alphabet::Language lang, int wordLength);
+
+public:
+    EmbeddedDictionary(Alphabet::Language lang, int wordLength);
+
+    static bool isAvailable(Alphabet::Language lang, int wordLength);
+
+    std::string getRandomWord() override;
+
+    bool isValidWord(const std::string &) override;
+
+    // keeps the draw mode of the previous list
+    void setLanguageAndWordLength(Alphabet::Language lang, int wordLength) override;
+
+    std::vector<std::string> getSuggestions(const std::string &inputWord, size_t maxCount) override;
+
+    std::shared_ptr<const WordIndex> getWordIndex() const override;
+
+    void setDrawMode(Dictionary::DrawMode drawMode);
+};
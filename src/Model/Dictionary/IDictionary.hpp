@@ -1,7 +1,19 @@
 #pragma once
 
 #include "Alphabet.hpp"
+#include <memory>
 #include <string>
+#include <vector>
+
+class WordIndex;
+
+// timings of the last hot reload, all zero if the dictionary was never reloaded
+struct DictionaryReloadStats
+{
+    int reloadsCount = 0;
+    double rebuildMs = 0.0;
+    double swapUs = 0.0;
+};
 
 class IDictionary
 {
@@ -12,5 +24,13 @@ public:
 
     virtual void setLanguageAndWordLength(Alphabet::Language, int) = 0;
 
+    virtual DictionaryReloadStats getReloadStats() const { return {}; }
+
+    // closest dictionary words to a rejected guess, empty if the dictionary cannot search by similarity
+    virtual std::vector<std::string> getSuggestions(const std::string &, size_t) { return {}; }
+
+    // current word list snapshot for the solver, nullptr if the dictionary does not keep one
+    virtual std::shared_ptr<const WordIndex> getWordIndex() const { return nullptr; }
+
     virtual ~IDictionary() = default;
 };
@@ -0,0 +1,64 @@
+#include "LetterCodec.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+LetterCodec::LetterCodec(Alphabet::Language lang) : table(&Alphabet::getTable(lang)), radix(0), maxPackedLength(0)
+{
+    // digit 0 is reserved, so words of different length never share a key
+    radix = table->lettersCount + 1;
+    std::uint64_t capacity = 1;
+    while (capacity <= (INVALID_KEY - 1) / radix)
+    {
+        capacity *= radix;
+        maxPackedLength++;
+    }
+}
+
+const LetterCodec &LetterCodec::forLanguage(Alphabet::Language lang)
+{
+    static const LetterCodec ENGLISH_CODEC(Alphabet::Language::ENGLISH);
+    static const LetterCodec RUSSIAN_CODEC(Alphabet::Language::RUSSIAN);
+    return lang == Alphabet::Language::RUSSIAN ? RUSSIAN_CODEC : ENGLISH_CODEC;
+}
+
+void LetterCodec::appendUtf8(std::string &text, char32_t codepoint)
+{
+    std::array<char, 4> bytes{};
+    text.append(bytes.data(), encodeUtf8(codepoint, bytes));
+}
+
+std::uint64_t LetterCodec::packWord(std::string_view word) const
+{
+    std::uint64_t key = 0;
+    int length = 0;
+    size_t position = 0;
+
+    while (position < word.size())
+    {
+        std::uint8_t letterIndex = getLetterIndex(decodeUtf8(word, position));
+        if (letterIndex == INVALID_LETTER || ++length > maxPackedLength)
+        {
+            return INVALID_KEY;
+        }
+        key = (key * radix) + letterIndex + 1;
+    }
+    return key;
+}
+
+std::string LetterCodec::unpackWord(std::uint64_t key) const
+{
+    std::vector<char32_t> wordLetters;
+    while (key != 0)
+    {
+        wordLetters.push_back(getLetter((key % radix) - 1));
+        key /= radix;
+    }
+
+    std::string word;
+    for (auto letter = wordLetters.rbegin(); letter != wordLetters.rend(); ++letter)
+    {
+        appendUtf8(word, *letter);
+    }
+    return word;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "Alphabet.hpp"
+#include "Utf8.hpp"
+
+// maps letters of a language to dense indices and packs whole words into integer keys;
+// the indices are the ones of the language's compile-time AlphabetTable
+class LetterCodec
+{
+public:
+    static constexpr std::uint8_t INVALID_LETTER = AlphabetTable::INVALID_LETTER;
+    static constexpr std::uint64_t INVALID_KEY = ~std::uint64_t{0};
+
+private:
+    const AlphabetTable *table;
+    std::uint64_t radix;
+    int maxPackedLength;
+
+public:
+    explicit LetterCodec(Alphabet::Language lang);
+
+    // shared codec of the language, lives until the program exits
+    static const LetterCodec &forLanguage(Alphabet::Language lang);
+
+    // decodes one utf-8 character starting at position and moves position past it
+    static char32_t decodeUtf8(std::string_view text, size_t &position) { return Utf8::decode(text, position); }
+
+    // writes the utf-8 bytes of codepoint, returns their number
+    static size_t encodeUtf8(char32_t codepoint, std::array<char, 4> &bytes) { return Utf8::encode(codepoint, bytes); }
+
+    static void appendUtf8(std::string &text, char32_t codepoint);
+
+    const AlphabetTable &getTable() const { return *table; }
+
+    std::uint8_t getLetterIndex(char32_t codepoint) const { return table->getLetterId(codepoint); }
+
+    char32_t getLetter(std::uint8_t letterIndex) const { return table->getLetter(letterIndex); }
+
+    // precomputed utf-8 of the capital letter, for display
+    std::string_view getUpperLetter(std::uint8_t letterIndex) const { return table->getUpperUtf8(letterIndex); }
+
+    size_t getLettersCount() const { return table->lettersCount; }
+
+    int getMaxPackedLength() const { return maxPackedLength; }
+
+    // INVALID_KEY if word has letters outside of the alphabet or is too long
+    std::uint64_t packWord(std::string_view word) const;
+
+    std::string unpackWord(std::uint64_t key) const;
+};
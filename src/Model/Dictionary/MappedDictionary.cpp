@@ -0,0 +1,137 @@
+#include "MappedDictionary.hpp"
+#include "Alphabet.hpp"
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <string>
+
+MappedDictionary::MappedDictionary(Alphabet::Language lang, int wordLength)
+    : MappedDictionary(getCompiledPath(lang, wordLength), wordLength)
+{
+}
+
+MappedDictionary::MappedDictionary(const std::filesystem::path &compiledDictionaryPath, int wordLength)
+    : dictionaryFile(compiledDictionaryPath),
+      header(nullptr), offsets(nullptr), index(nullptr), words(nullptr),
+      rndGenerator(std::random_device{}())
+{
+    attach(wordLength);
+}
+
+std::filesystem::path MappedDictionary::getCompiledPath(Alphabet::Language lang, int wordLength)
+{
+    return COMPILED_DICTIONARIES_DIR "/" + Alphabet::getLanguageString(lang) +
+           std::format("_DICTIONARY_{}L.bin", wordLength);
+}
+
+void MappedDictionary::attach(int wordLength)
+{
+    const std::byte *base = dictionaryFile.getData();
+    const size_t fileSize = dictionaryFile.getSize();
+
+    if (fileSize < sizeof(CompiledDictionaryHeader))
+    {
+        throw std::runtime_error("Повреждённый файл словаря!");
+    }
+
+    const auto *newHeader = reinterpret_cast<const CompiledDictionaryHeader *>(base);
+    if (newHeader->magic != CompiledDictionaryHeader::MAGIC ||
+        newHeader->version != CompiledDictionaryHeader::VERSION)
+    {
+        throw std::runtime_error("Неподдерживаемый формат файла словаря!");
+    }
+    if (wordLength < 0 || newHeader->wordLength != static_cast<std::uint32_t>(wordLength))
+    {
+        throw std::runtime_error("Файл словаря собран для другой длины слова!");
+    }
+
+    // positions are checked first, so the section ends below cannot overflow
+    const bool isPositionValid = newHeader->offsetsPosition <= fileSize && newHeader->indexPosition <= fileSize &&
+                                 newHeader->wordsPosition <= fileSize &&
+                                 newHeader->offsetsPosition % alignof(std::uint32_t) == 0 &&
+                                 newHeader->indexPosition % alignof(std::uint32_t) == 0;
+    if (!isPositionValid || newHeader->wordsSize > fileSize)
+    {
+        throw std::runtime_error("Повреждённый файл словаря!");
+    }
+
+    const std::uint64_t offsetsEnd = newHeader->offsetsPosition + ((std::uint64_t{newHeader->wordsCount} + 1) * sizeof(std::uint32_t));
+    const std::uint64_t indexEnd = newHeader->indexPosition + (std::uint64_t{newHeader->indexSize} * sizeof(std::uint32_t));
+    const std::uint64_t wordsEnd = newHeader->wordsPosition + newHeader->wordsSize;
+    if (newHeader->wordsCount == 0 || newHeader->indexSize == 0 || offsetsEnd > fileSize || indexEnd > fileSize ||
+        wordsEnd > fileSize || (newHeader->indexSize & (newHeader->indexSize - 1)) != 0)
+    {
+        throw std::runtime_error("Повреждённый файл словаря!");
+    }
+
+    header = newHeader;
+    offsets = reinterpret_cast<const std::uint32_t *>(base + header->offsetsPosition);
+    index = reinterpret_cast<const std::uint32_t *>(base + header->indexPosition);
+    words = reinterpret_cast<const char *>(base + header->wordsPosition);
+}
+
+bool MappedDictionary::isWordInBlob(std::uint32_t wordNumber) const
+{
+    return wordNumber < header->wordsCount && offsets[wordNumber] <= offsets[wordNumber + 1] &&
+           offsets[wordNumber + 1] <= header->wordsSize;
+}
+
+std::string_view MappedDictionary::getWord(std::uint32_t wordNumber) const
+{
+    if (!isWordInBlob(wordNumber))
+    {
+        throw std::runtime_error("Повреждённый файл словаря!");
+    }
+    return {words + offsets[wordNumber], offsets[wordNumber + 1] - offsets[wordNumber]};
+}
+
+std::string_view MappedDictionary::getRandomWordView()
+{
+    std::uniform_int_distribution<std::uint32_t> randomIndex(0, header->wordsCount - 1);
+    return getWord(randomIndex(rndGenerator));
+}
+
+bool MappedDictionary::containsWord(std::string_view word) const
+{
+    const std::uint32_t mask = header->indexSize - 1;
+    auto slot = static_cast<std::uint32_t>(CompiledDictionaryFormat::hash(word)) & mask;
+
+    // linear probing, bounded by the table size in case a damaged table has no empty slot;
+    // damaged slots and offsets never match
+    for (std::uint32_t probe = 0; probe < header->indexSize && index[slot] != CompiledDictionaryFormat::EMPTY_SLOT; ++probe)
+    {
+        const std::uint32_t wordNumber = index[slot] - 1;
+        if (isWordInBlob(wordNumber) &&
+            std::string_view(words + offsets[wordNumber], offsets[wordNumber + 1] - offsets[wordNumber]) == word)
+        {
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+std::string MappedDictionary::getRandomWord()
+{
+    return std::string(getRandomWordView());
+}
+
+bool MappedDictionary::isValidWord(const std::string &inputWord)
+{
+    return containsWord(inputWord);
+}
+
+void MappedDictionary::setLanguageAndWordLength(Alphabet::Language lang, int wordLength)
+{
+    MappedFile newFile(getCompiledPath(lang, wordLength));
+    std::swap(dictionaryFile, newFile);
+    try
+    {
+        attach(wordLength);
+    }
+    catch (...)
+    {
+        std::swap(dictionaryFile, newFile);
+        throw;
+    }
+}
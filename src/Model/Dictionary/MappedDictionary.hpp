@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "CompiledDictionaryFormat.hpp"
+#include "IDictionary.hpp"
+#include "MappedFile.hpp"
+
+// dictionary served straight from a memory-mapped file built by DictionaryCompiler
+class MappedDictionary : public IDictionary
+{
+private:
+    MappedFile dictionaryFile;
+    const CompiledDictionaryHeader *header;
+    const std::uint32_t *offsets;
+    const std::uint32_t *index;
+    const char *words;
+    std::mt19937 rndGenerator;
+
+    // maps the sections of the file, throws if the header is damaged or is of another word length;
+    // only the header is read, so opening touches no page of the tables
+    void attach(int wordLength);
+
+    // the offsets of the word are ordered and inside the words blob, checked on every access
+    bool isWordInBlob(std::uint32_t wordNumber) const;
+
+public:
+    MappedDictionary(Alphabet::Language lang, int wordLength);
+
+    MappedDictionary(const std::filesystem::path &compiledDictionaryPath, int wordLength);
+
+    static std::filesystem::path getCompiledPath(Alphabet::Language lang, int wordLength);
+
+    std::string getRandomWord() override;
+
+    bool isValidWord(const std::string &) override;
+
+    void setLanguageAndWordLength(Alphabet::Language lang, int wordLength) override;
+
+    // zero-copy access, views point into the mapping
+    std::string_view getRandomWordView();
+
+    bool containsWord(std::string_view word) const;
+
+    // throws if the number is out of range or the file's offsets of the word are damaged
+    std::string_view getWord(std::uint32_t wordNumber) const;
+
+    std::uint32_t getWordsCount() const { return header->wordsCount; }
+
+    ~MappedDictionary() override = default;
+
+    MappedDictionary(MappedDictionary &&other) noexcept = default;
+
+    MappedDictionary &operator=(MappedDictionary &&other) noexcept = default;
+
+    MappedDictionary(const MappedDictionary &other) = delete;
+
+    MappedDictionary &operator=(const MappedDictionary &other) = delete;
+};
@@ -0,0 +1,148 @@
+#include "MappedFile.hpp"
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path &path) : data(nullptr), size(0),
+                                                            fileHandle(INVALID_HANDLE_VALUE),
+                                                            mappingHandle(nullptr)
+{
+    fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error("Не удалось открыть файл: " + path.string());
+    }
+
+    LARGE_INTEGER fileSize{};
+    GetFileSizeEx(fileHandle, &fileSize);
+    size = static_cast<size_t>(fileSize.QuadPart);
+    if (size == 0)
+    {
+        unmap();
+        throw std::runtime_error("Файл пуст: " + path.string());
+    }
+
+    mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle != nullptr)
+    {
+        data = static_cast<const std::byte *>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (data == nullptr)
+    {
+        unmap();
+        throw std::runtime_error("Не удалось отобразить файл в память: " + path.string());
+    }
+}
+
+void MappedFile::unmap()
+{
+    if (data != nullptr)
+    {
+        UnmapViewOfFile(data);
+    }
+    if (mappingHandle != nullptr)
+    {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(fileHandle);
+    }
+    data = nullptr;
+    size = 0;
+    mappingHandle = nullptr;
+    fileHandle = INVALID_HANDLE_VALUE;
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept : data(std::exchange(other.data, nullptr)),
+                                                      size(std::exchange(other.size, 0)),
+                                                      fileHandle(std::exchange(other.fileHandle, INVALID_HANDLE_VALUE)),
+                                                      mappingHandle(std::exchange(other.mappingHandle, nullptr))
+{
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+        std::swap(fileHandle, other.fileHandle);
+        std::swap(mappingHandle, other.mappingHandle);
+    }
+    return *this;
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path &path) : data(nullptr), size(0)
+{
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw std::runtime_error("Не удалось открыть файл: " + path.string());
+    }
+
+    struct stat fileStat{};
+    if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fileDescriptor);
+        throw std::runtime_error("Файл пуст: " + path.string());
+    }
+    size = static_cast<size_t>(fileStat.st_size);
+
+    // mapping keeps its own reference to the file
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapped == MAP_FAILED)
+    {
+        size = 0;
+        throw std::runtime_error("Не удалось отобразить файл в память: " + path.string());
+    }
+    data = static_cast<const std::byte *>(mapped);
+}
+
+void MappedFile::unmap()
+{
+    if (data != nullptr)
+    {
+        munmap(const_cast<std::byte *>(data), size);
+    }
+    data = nullptr;
+    size = 0;
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept : data(std::exchange(other.data, nullptr)),
+                                                      size(std::exchange(other.size, 0))
+{
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+    }
+    return *this;
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+
+// read-only memory mapping of a whole file
+class MappedFile
+{
+private:
+    const std::byte *data;
+    size_t size;
+
+#ifdef _WIN32
+    void *fileHandle;
+    void *mappingHandle;
+#endif
+
+    void unmap();
+
+public:
+    explicit MappedFile(const std::filesystem::path &path);
+
+    const std::byte *getData() const { return data; }
+
+    size_t getSize() const { return size; }
+
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other) noexcept;
+
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    MappedFile(const MappedFile &other) = delete;
+
+    MappedFile &operator=(const MappedFile &other) = delete;
+};
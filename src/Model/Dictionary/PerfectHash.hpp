@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+// Minimal perfect hash built by "hash and displace": keys are split into buckets by one hash,
+// then every bucket, largest first, gets a seed that moves all its keys into free slots.
+// Single-key buckets skip the search and store their slot directly.
+// build() is constexpr, so tables for embedded word lists are computed by the compiler.
+class PerfectHash
+{
+public:
+    static constexpr std::uint32_t DIRECT_SLOT = 1U << 31;
+
+    PerfectHash() = delete;
+
+    template <size_t N>
+    struct Table
+    {
+        static constexpr size_t BUCKETS_COUNT = (N / 2) + 1;
+
+        std::array<std::uint32_t, BUCKETS_COUNT> seeds;
+        std::array<std::uint32_t, N> slotWords; // slot -> index of the word in the source list
+    };
+
+    static constexpr std::uint64_t hashWord(std::string_view word)
+    {
+        std::uint64_t hashValue = 14695981039346656037ULL;
+        for (char chr : word)
+        {
+            hashValue ^= static_cast<unsigned char>(chr);
+            hashValue *= 1099511628211ULL;
+        }
+        return hashValue;
+    }
+
+    static constexpr std::uint64_t slotHash(std::uint64_t hashValue, std::uint32_t seed)
+    {
+        // splitmix64 finalizer
+        std::uint64_t mixed = hashValue ^ (seed * 0x9E3779B97F4A7C15ULL);
+        mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+        return mixed ^ (mixed >> 31);
+    }
+
+    // index of the only word that may be equal to word, caller compares
+    static constexpr std::uint32_t lookup(std::string_view word,
+                                          std::span<const std::uint32_t> seeds,
+                                          std::span<const std::uint32_t> slotWords)
+    {
+        const std::uint64_t hashValue = hashWord(word);
+        const std::uint32_t seed = seeds[hashValue % seeds.size()];
+        if ((seed & DIRECT_SLOT) != 0)
+        {
+            return slotWords[seed & ~DIRECT_SLOT];
+        }
+        return slotWords[slotHash(hashValue, seed) % slotWords.size()];
+    }
+
+    // words must be unique
+    template <size_t N>
+    static constexpr Table<N> build(const std::string_view (&words)[N])
+    {
+        constexpr size_t BUCKETS_COUNT = Table<N>::BUCKETS_COUNT;
+        constexpr std::uint32_t MAX_SEED = 1U << 20;
+
+        Table<N> table{};
+
+        std::array<std::uint64_t, N> hashes{};
+        std::array<std::uint32_t, BUCKETS_COUNT + 1> bucketStart{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            hashes[i] = hashWord(words[i]);
+            bucketStart[(hashes[i] % BUCKETS_COUNT) + 1]++;
+        }
+        std::partial_sum(bucketStart.begin(), bucketStart.end(), bucketStart.begin());
+
+        // keys grouped by bucket
+        std::array<std::uint32_t, N> bucketKeys{};
+        std::array<std::uint32_t, BUCKETS_COUNT> bucketFill{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            const size_t bucket = hashes[i] % BUCKETS_COUNT;
+            bucketKeys[bucketStart[bucket] + bucketFill[bucket]++] = static_cast<std::uint32_t>(i);
+        }
+
+        std::array<std::uint32_t, BUCKETS_COUNT> bucketOrder{};
+        std::iota(bucketOrder.begin(), bucketOrder.end(), 0U);
+        std::sort(bucketOrder.begin(), bucketOrder.end(), [&](std::uint32_t lhs, std::uint32_t rhs)
+                  { return bucketFill[lhs] > bucketFill[rhs] || (bucketFill[lhs] == bucketFill[rhs] && lhs < rhs); });
+
+        std::array<bool, N> isTaken{};
+        std::array<std::uint32_t, N> bucketSlots{};
+
+        size_t orderPosition = 0;
+        for (; orderPosition < BUCKETS_COUNT && bucketFill[bucketOrder[orderPosition]] > 1; ++orderPosition)
+        {
+            const std::uint32_t bucket = bucketOrder[orderPosition];
+            const std::uint32_t bucketSize = bucketFill[bucket];
+
+            std::uint32_t seed = 0;
+            for (;; ++seed)
+            {
+                if (seed == MAX_SEED)
+                {
+                    throw std::logic_error("PerfectHash: no seed found, are the words unique?");
+                }
+
+                std::uint32_t placed = 0;
+                for (; placed < bucketSize; ++placed)
+                {
+                    const std::uint32_t key = bucketKeys[bucketStart[bucket] + placed];
+                    const auto slot = static_cast<std::uint32_t>(slotHash(hashes[key], seed) % N);
+                    if (isTaken[slot])
+                    {
+                        break;
+                    }
+                    isTaken[slot] = true;
+                    bucketSlots[placed] = slot;
+                }
+
+                if (placed == bucketSize)
+                {
+                    break;
+                }
+                for (std::uint32_t i = 0; i < placed; ++i)
+                {
+                    isTaken[bucketSlots[i]] = false;
+                }
+            }
+
+            table.seeds[bucket] = seed;
+            for (std::uint32_t i = 0; i < bucketSize; ++i)
+            {
+                table.slotWords[bucketSlots[i]] = bucketKeys[bucketStart[bucket] + i];
+            }
+        }
+
+        // remaining free slots go to single-key buckets
+        std::uint32_t freeSlot = 0;
+        for (; orderPosition < BUCKETS_COUNT && bucketFill[bucketOrder[orderPosition]] == 1; ++orderPosition)
+        {
+            const std::uint32_t bucket = bucketOrder[orderPosition];
+            while (isTaken[freeSlot])
+            {
+                freeSlot++;
+            }
+            isTaken[freeSlot] = true;
+            table.seeds[bucket] = DIRECT_SLOT | freeSlot;
+            table.slotWords[freeSlot] = bucketKeys[bucketStart[bucket]];
+        }
+        return table;
+    }
+};
@@ -0,0 +1,38 @@
+#include "RegisteredDictionary.hpp"
+#include <utility>
+
+RegisteredDictionary::RegisteredDictionary(std::shared_ptr<DictionaryRegistry> _registry,
+                                           Alphabet::Language lang, int wordLength)
+    : registry(std::move(_registry)), dictionary(registry->acquire(lang, wordLength))
+{
+}
+
+std::string RegisteredDictionary::getRandomWord()
+{
+    return dictionary->getRandomWord();
+}
+
+bool RegisteredDictionary::isValidWord(const std::string &inputWord)
+{
+    return dictionary->isValidWord(inputWord);
+}
+
+void RegisteredDictionary::setLanguageAndWordLength(Alphabet::Language lang, int wordLength)
+{
+    dictionary = registry->acquire(lang, wordLength);
+}
+
+DictionaryReloadStats RegisteredDictionary::getReloadStats() const
+{
+    return dictionary->getReloadStats();
+}
+
+std::vector<std::string> RegisteredDictionary::getSuggestions(const std::string &inputWord, size_t maxCount)
+{
+    return dictionary->getSuggestions(inputWord, maxCount);
+}
+
+std::shared_ptr<const WordIndex> RegisteredDictionary::getWordIndex() const
+{
+    return dictionary->getWordIndex();
+}
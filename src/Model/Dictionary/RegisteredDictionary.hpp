@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Dictionary.hpp"
+#include "DictionaryRegistry.hpp"
+#include "IDictionary.hpp"
+
+// IDictionary handle on top of DictionaryRegistry, switching language or length
+// takes an already resident dictionary instead of reading a file
+class RegisteredDictionary : public IDictionary
+{
+private:
+    std::shared_ptr<DictionaryRegistry> registry;
+    std::shared_ptr<Dictionary> dictionary;
+
+public:
+    RegisteredDictionary(std::shared_ptr<DictionaryRegistry> registry, Alphabet::Language lang, int wordLength);
+
+    std::string getRandomWord() override;
+
+    bool isValidWord(const std::string &) override;
+
+    void setLanguageAndWordLength(Alphabet::Language lang, int wordLength) override;
+
+    DictionaryReloadStats getReloadStats() const override;
+
+    std::vector<std::string> getSuggestions(const std::string &inputWord, size_t maxCount) override;
+
+    std::shared_ptr<const WordIndex> getWordIndex() const override;
+};
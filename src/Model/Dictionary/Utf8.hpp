@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+// utf-8 primitives usable at compile time
+class Utf8
+{
+public:
+    Utf8() = delete;
+
+    // decodes one character starting at position and moves position past it
+    static constexpr char32_t decode(std::string_view text, size_t &position)
+    {
+        auto leadByte = static_cast<unsigned char>(text[position++]);
+        int continuationBytes = 0;
+        char32_t codepoint = leadByte;
+
+        if ((leadByte & 0xE0) == 0xC0)
+        {
+            codepoint = leadByte & 0x1F;
+            continuationBytes = 1;
+        }
+        else if ((leadByte & 0xF0) == 0xE0)
+        {
+            codepoint = leadByte & 0x0F;
+            continuationBytes = 2;
+        }
+        else if ((leadByte & 0xF8) == 0xF0)
+        {
+            codepoint = leadByte & 0x07;
+            continuationBytes = 3;
+        }
+
+        for (; continuationBytes > 0 && position < text.size(); --continuationBytes)
+        {
+            codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[position++]) & 0x3F);
+        }
+        return codepoint;
+    }
+
+    // writes the bytes of codepoint, returns their number
+    static constexpr size_t encode(char32_t codepoint, std::array<char, 4> &bytes)
+    {
+        if (codepoint < 0x80)
+        {
+            bytes[0] = static_cast<char>(codepoint);
+            return 1;
+        }
+        if (codepoint < 0x800)
+        {
+            bytes[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+            bytes[1] = static_cast<char>(0x80 | (codepoint & 0x3F));
+            return 2;
+        }
+        if (codepoint < 0x10000)
+        {
+            bytes[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+            bytes[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            bytes[2] = static_cast<char>(0x80 | (codepoint & 0x3F));
+            return 3;
+        }
+        bytes[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+        bytes[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+        bytes[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        bytes[3] = static_cast<char>(0x80 | (codepoint & 0x3F));
+        return 4;
+    }
+};
@@ -0,0 +1,431 @@
+#include "WordIndex.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+static void prefetch(const void *address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(_MSC_VER)
+    _mm_prefetch(static_cast<const char *>(address), _MM_HINT_T0);
+#endif
+}
+
+WordIndex::WordIndex(const WordListPaths &paths, Alphabet::Language lang, int _wordLength,
+                     std::span<const std::string> extraWords) : letterCodec(lang), searchDepth(0),
+                                                                                wordLength(_wordLength)
+{
+    wordStorage = readFile(paths.allowed);
+    for (const std::string &extraWord : extraWords)
+    {
+        wordStorage.push_back('\n');
+        wordStorage.insert(wordStorage.end(), extraWord.begin(), extraWord.end());
+    }
+    words = splitLines(wordStorage);
+    build(paths);
+}
+
+WordIndex::WordIndex(std::span<const std::string_view> allowedWords, Alphabet::Language lang, int _wordLength)
+    : letterCodec(lang), searchDepth(0), wordLength(_wordLength)
+{
+    // the views are kept, the words live as long as the program
+    words.assign(allowedWords.begin(), allowedWords.end());
+    build({});
+}
+
+void WordIndex::build(const WordListPaths &paths)
+{
+    if (words.empty())
+    {
+        throw std::runtime_error("Файл словаря пуст!");
+    }
+
+    if (wordLength > letterCodec.getMaxPackedLength())
+    {
+        throw std::runtime_error("Слишком длинные слова для словаря!");
+    }
+
+    if (!paths.answers.empty() && std::filesystem::exists(paths.answers))
+    {
+        answerStorage = readFile(paths.answers);
+        answers = splitLines(answerStorage);
+        addMissingAnswers();
+    }
+    if (answers.empty())
+    {
+        answers = words;
+    }
+    // a target that cannot be spelled in the alphabet at this length could never be guessed
+    std::erase_if(answers, [this](std::string_view answer) { return !isPlayableWord(answer); });
+    if (answers.empty())
+    {
+        throw std::runtime_error("В словаре нет слов, которые можно загадать!");
+    }
+
+    std::vector<std::uint64_t> sortedKeys;
+    sortedKeys.reserve(words.size());
+    for (std::string_view word : words)
+    {
+        std::uint64_t key = letterCodec.packWord(word);
+        if (key != LetterCodec::INVALID_KEY)
+        {
+            sortedKeys.push_back(key);
+        }
+    }
+    std::ranges::sort(sortedKeys);
+    sortedKeys.erase(std::ranges::unique(sortedKeys).begin(), sortedKeys.end());
+
+    buildEytzingerKeys(std::move(sortedKeys));
+    buildAnswerSampler(paths.frequencies);
+    buildWordLetters();
+}
+
+void WordIndex::addMissingAnswers()
+{
+    // an answer missing from the allowed list is still accepted as a guess, and it needs a
+    // letter block like every other word, or the candidates and hints would never contain it
+    std::vector<std::string_view> sortedWords = words;
+    std::ranges::sort(sortedWords);
+    std::vector<std::string_view> missingAnswers;
+    for (std::string_view answer : answers)
+    {
+        if (!std::ranges::binary_search(sortedWords, answer))
+        {
+            missingAnswers.push_back(answer);
+        }
+    }
+    std::ranges::sort(missingAnswers);
+    missingAnswers.erase(std::ranges::unique(missingAnswers).begin(), missingAnswers.end());
+    words.insert(words.end(), missingAnswers.begin(), missingAnswers.end());
+}
+
+bool WordIndex::isPlayableWord(std::string_view word) const
+{
+    size_t position = 0;
+    int lettersCount = 0;
+    while (position < word.size() && lettersCount <= wordLength)
+    {
+        if (letterCodec.getLetterIndex(LetterCodec::decodeUtf8(word, position)) == LetterCodec::INVALID_LETTER)
+        {
+            return false;
+        }
+        lettersCount++;
+    }
+    return lettersCount == wordLength;
+}
+
+void WordIndex::buildWordLetters()
+{
+    // without an answers file every word is an answer
+    std::vector<std::string_view> sortedAnswers;
+    if (!answerStorage.empty())
+    {
+        sortedAnswers = answers;
+        std::ranges::sort(sortedAnswers);
+    }
+
+    wordLetters.reserve(words.size() * wordLength);
+    for (size_t wordNumber = 0; wordNumber < words.size(); ++wordNumber)
+    {
+        const size_t blockStart = wordLetters.size();
+        size_t position = 0;
+        int lettersCount = 0;
+        while (position < words[wordNumber].size() && lettersCount <= wordLength)
+        {
+            wordLetters.push_back(letterCodec.getLetterIndex(LetterCodec::decodeUtf8(words[wordNumber], position)));
+            lettersCount++;
+        }
+
+        const bool isUsable = lettersCount == wordLength &&
+                              std::find(wordLetters.begin() + static_cast<std::ptrdiff_t>(blockStart), wordLetters.end(),
+                                        LetterCodec::INVALID_LETTER) == wordLetters.end();
+        if (isUsable)
+        {
+            if (answerStorage.empty() || std::ranges::binary_search(sortedAnswers, words[wordNumber]))
+            {
+                answerBlocks.push_back(static_cast<std::uint32_t>(lettersWordNumbers.size()));
+            }
+            lettersWordNumbers.push_back(static_cast<std::uint32_t>(wordNumber));
+
+            std::uint64_t letterSet = 0;
+            for (size_t i = blockStart; i < wordLetters.size(); ++i)
+            {
+                letterSet |= std::uint64_t{1} << (wordLetters[i] & 63);
+            }
+            wordLetterSets.push_back(letterSet);
+        }
+        else
+        {
+            wordLetters.resize(blockStart);
+        }
+    }
+}
+
+std::vector<std::string_view> WordIndex::findClosestWords(std::string_view word, size_t maxCount, int maxDistance) const
+{
+    // Myers' bit-parallel Levenshtein: the column of the DP table for the input word is kept
+    // as bit vectors of +1/-1 vertical deltas and each dictionary letter updates it in O(1)
+    std::array<std::uint64_t, 256> letterMasks{};
+    std::uint64_t patternLetterSet = 0;
+    int patternLength = 0;
+    for (size_t position = 0; position < word.size() && patternLength < 64; ++patternLength)
+    {
+        const std::uint8_t letterIndex = letterCodec.getLetterIndex(LetterCodec::decodeUtf8(word, position));
+        if (letterIndex != LetterCodec::INVALID_LETTER)
+        {
+            letterMasks[letterIndex] |= std::uint64_t{1} << patternLength;
+            patternLetterSet |= std::uint64_t{1} << (letterIndex & 63);
+        }
+    }
+    // letter sets alias for larger alphabets, the filter is skipped then
+    const bool isLetterSetFilterUsable = letterCodec.getLettersCount() <= 64;
+    if (patternLength == 0 || maxCount == 0)
+    {
+        return {};
+    }
+
+    const std::uint64_t lastBit = std::uint64_t{1} << (patternLength - 1);
+    const std::uint64_t allBits = patternLength == 64 ? ~std::uint64_t{0} : (lastBit << 1) - 1;
+
+    // best candidates sorted by distance, ties keep dictionary order
+    std::vector<std::pair<int, std::uint32_t>> closest;
+    closest.reserve(maxCount + 1);
+
+    for (size_t block = 0; block < lettersWordNumbers.size(); ++block)
+    {
+        // every distinct letter missing from the input costs at least one edit
+        const int distanceLimit = closest.size() == maxCount ? closest.back().first - 1 : maxDistance;
+        if (isLetterSetFilterUsable && std::popcount(wordLetterSets[block] & ~patternLetterSet) > distanceLimit)
+        {
+            continue;
+        }
+
+        const std::uint8_t *letters = wordLetters.data() + (block * wordLength);
+
+        std::uint64_t positiveVertical = allBits;
+        std::uint64_t negativeVertical = 0;
+        int distance = patternLength;
+        for (int i = 0; i < wordLength; ++i)
+        {
+            const std::uint64_t equal = letterMasks[letters[i]];
+            const std::uint64_t verticalChange = equal | negativeVertical;
+            const std::uint64_t horizontalChange = (((equal & positiveVertical) + positiveVertical) ^ positiveVertical) | equal;
+            std::uint64_t positiveHorizontal = negativeVertical | ~(horizontalChange | positiveVertical);
+            std::uint64_t negativeHorizontal = positiveVertical & horizontalChange;
+
+            distance += static_cast<int>((positiveHorizontal & lastBit) != 0) - static_cast<int>((negativeHorizontal & lastBit) != 0);
+
+            // first row of the table grows by one per letter
+            positiveHorizontal = (positiveHorizontal << 1) | 1;
+            negativeHorizontal <<= 1;
+            positiveVertical = (negativeHorizontal | ~(verticalChange | positiveHorizontal)) & allBits;
+            negativeVertical = positiveHorizontal & verticalChange & allBits;
+        }
+
+        if (distance == 0 || distance > distanceLimit)
+        {
+            continue;
+        }
+
+        auto insertAt = std::ranges::upper_bound(closest, distance, {}, &std::pair<int, std::uint32_t>::first);
+        closest.insert(insertAt, {distance, lettersWordNumbers[block]});
+        if (closest.size() > maxCount)
+        {
+            closest.pop_back();
+        }
+    }
+
+    std::vector<std::string_view> closestWords;
+    closestWords.reserve(closest.size());
+    for (const auto &[distance, wordNumber] : closest)
+    {
+        closestWords.push_back(words[wordNumber]);
+    }
+    return closestWords;
+}
+
+std::vector<char> WordIndex::readFile(const std::filesystem::path &path)
+{
+    std::ifstream wordsFile(path, std::ios::binary);
+    if (!wordsFile.is_open())
+    {
+        throw std::runtime_error("Не удалось открыть файл словаря!");
+    }
+
+    // read whole file in one go, words are parsed in place
+    std::vector<char> storage(std::filesystem::file_size(path));
+    wordsFile.read(storage.data(), static_cast<std::streamsize>(storage.size()));
+    storage.resize(wordsFile.gcount());
+    return storage;
+}
+
+std::vector<std::string_view> WordIndex::splitLines(const std::vector<char> &storage)
+{
+    std::vector<std::string_view> lines;
+    std::string_view content(storage.data(), storage.size());
+    while (!content.empty())
+    {
+        size_t lineEnd = content.find('\n');
+        std::string_view line = content.substr(0, lineEnd);
+        content.remove_prefix(lineEnd == std::string_view::npos ? content.size() : lineEnd + 1);
+
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.remove_suffix(1);
+        }
+        if (!line.empty())
+        {
+            lines.push_back(line);
+        }
+    }
+    return lines;
+}
+
+void WordIndex::buildAnswerSampler(const std::filesystem::path &pathToFrequencies)
+{
+    std::unordered_map<std::string_view, std::uint64_t> frequencies;
+    std::vector<char> frequencyStorage;
+    if (!pathToFrequencies.empty() && std::filesystem::exists(pathToFrequencies))
+    {
+        frequencyStorage = readFile(pathToFrequencies);
+        for (std::string_view line : splitLines(frequencyStorage))
+        {
+            const size_t separator = line.find(' ');
+            if (separator == std::string_view::npos)
+            {
+                continue;
+            }
+            std::uint64_t count = 0;
+            std::from_chars(line.data() + separator + 1, line.data() + line.size(), count);
+            frequencies[line.substr(0, separator)] = count;
+        }
+    }
+
+    // square root keeps the most common words from crowding out the rest,
+    // answers without a known frequency count as seen once
+    std::vector<double> weights;
+    weights.reserve(answers.size());
+    for (std::string_view answer : answers)
+    {
+        auto found = frequencies.find(answer);
+        const std::uint64_t count = found == frequencies.end() ? 1 : std::max<std::uint64_t>(found->second, 1);
+        weights.push_back(std::sqrt(static_cast<double>(count)));
+    }
+    answerSampler = AliasTable(weights);
+}
+
+void WordIndex::buildEytzingerKeys(std::vector<std::uint64_t> sortedKeys)
+{
+    // pad to a full tree, so every search takes exactly searchDepth steps
+    searchDepth = std::bit_width(sortedKeys.size());
+    const size_t treeSize = (size_t{1} << searchDepth) - 1;
+    sortedKeys.resize(treeSize, LetterCodec::INVALID_KEY);
+
+    eytzingerKeys.assign(treeSize + 1, LetterCodec::INVALID_KEY);
+
+    // in-order walk of the implicit tree hands out sorted keys
+    size_t sortedIndex = 0;
+    size_t node = 1;
+    while (sortedIndex < treeSize)
+    {
+        while (node <= treeSize)
+        {
+            node *= 2;
+        }
+        node = lowerBoundNode(node);
+        eytzingerKeys[node] = sortedKeys[sortedIndex++];
+        node = (node * 2) + 1;
+    }
+}
+
+size_t WordIndex::lowerBoundNode(size_t node)
+{
+    // climb while we came from a right child, then one more step
+    return node >> (std::countr_one(node) + 1);
+}
+
+bool WordIndex::containsWord(std::string_view word) const
+{
+    return containsKey(letterCodec.packWord(word));
+}
+
+bool WordIndex::containsKey(std::uint64_t key) const
+{
+    size_t node = 1;
+    for (int step = 0; step < searchDepth; ++step)
+    {
+        node = (node * 2) + static_cast<size_t>(eytzingerKeys[node] < key);
+    }
+    return eytzingerKeys[lowerBoundNode(node)] == key && key != LetterCodec::INVALID_KEY;
+}
+
+void WordIndex::containsKeys(std::span<const std::uint64_t> keys, std::span<bool> results) const
+{
+    // searches run in lockstep groups, so the memory loads of a group overlap
+    constexpr size_t GROUP_SIZE = 16;
+    constexpr size_t PREFETCH_DISTANCE = 16; // four levels down fill one 128-byte block
+
+    std::array<size_t, GROUP_SIZE> nodes{};
+    const size_t treeSize = eytzingerKeys.size();
+
+    for (size_t groupStart = 0; groupStart < keys.size(); groupStart += GROUP_SIZE)
+    {
+        const size_t groupSize = std::min(GROUP_SIZE, keys.size() - groupStart);
+        nodes.fill(1);
+
+        for (int step = 0; step < searchDepth; ++step)
+        {
+            for (size_t i = 0; i < groupSize; ++i)
+            {
+                size_t node = nodes[i];
+                if (node * PREFETCH_DISTANCE < treeSize)
+                {
+                    prefetch(&eytzingerKeys[node * PREFETCH_DISTANCE]);
+                }
+                nodes[i] = (node * 2) + static_cast<size_t>(eytzingerKeys[node] < keys[groupStart + i]);
+            }
+        }
+
+        for (size_t i = 0; i < groupSize; ++i)
+        {
+            const std::uint64_t key = keys[groupStart + i];
+            results[groupStart + i] = eytzingerKeys[lowerBoundNode(nodes[i])] == key && key != LetterCodec::INVALID_KEY;
+        }
+    }
+}
+
+void WordIndex::areValidWords(std::span<const std::string_view> candidates, std::span<bool> results) const
+{
+    std::vector<std::uint64_t> keys;
+    keys.reserve(candidates.size());
+    for (std::string_view candidate : candidates)
+    {
+        keys.push_back(letterCodec.packWord(candidate));
+    }
+    containsKeys(keys, results);
+}
+
+size_t WordIndex::getMemoryUsage() const
+{
+    return wordStorage.capacity() +
+           (words.capacity() * sizeof(std::string_view)) +
+           (eytzingerKeys.capacity() * sizeof(std::uint64_t)) +
+           answerStorage.capacity() +
+           (answers.capacity() * sizeof(std::string_view)) +
+           answerSampler.getMemoryUsage() +
+           wordLetters.capacity() +
+           (lettersWordNumbers.capacity() * sizeof(std::uint32_t)) +
+           (answerBlocks.capacity() * sizeof(std::uint32_t)) +
+           (wordLetterSets.capacity() * sizeof(std::uint64_t));
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "AliasTable.hpp"
+#include "Alphabet.hpp"
+#include "LetterCodec.hpp"
+
+// files of one dictionary, answers and frequencies are optional and may be empty paths
+struct WordListPaths
+{
+    std::filesystem::path allowed;     // every word accepted as a guess
+    std::filesystem::path answers;     // curated words that may become the target
+    std::filesystem::path frequencies; // "word count" lines weighting the answers
+};
+
+// Immutable word list of one dictionary file together with its search index.
+// Dictionary publishes it through a shared pointer, so readers keep a consistent
+// snapshot while a newer one is being built.
+class WordIndex
+{
+private:
+    // whole dictionary file, words are views into this buffer; empty for a static word list
+    std::vector<char> wordStorage;
+    std::vector<std::string_view> words;
+
+    // packed word keys in Eytzinger (BFS) order, 1-based and padded to a full tree
+    LetterCodec letterCodec;
+    std::vector<std::uint64_t> eytzingerKeys;
+    int searchDepth;
+
+    // target candidates, all allowed words if there is no answers file; only words of the
+    // dictionary length spelled in the alphabet, every one of them has a letter block
+    std::vector<char> answerStorage;
+    std::vector<std::string_view> answers;
+    AliasTable answerSampler;
+
+    // letter indices of every word of the dictionary length, wordLength per word, for suggestions
+    int wordLength;
+    std::vector<std::uint8_t> wordLetters;
+    std::vector<std::uint32_t> lettersWordNumbers; // word number for every wordLength block
+    std::vector<std::uint64_t> wordLetterSets;     // bit per letter present in the block, alphabets up to 64 letters
+    std::vector<std::uint32_t> answerBlocks;       // blocks whose word is also an answer
+
+    static std::vector<char> readFile(const std::filesystem::path &path);
+
+    // answers, the search index and letter blocks of the words, answers and frequencies are read
+    // from the paths if they are given
+    void build(const WordListPaths &paths);
+
+    // non-empty lines as views into storage
+    static std::vector<std::string_view> splitLines(const std::vector<char> &storage);
+
+    // answers missing from the allowed list are appended to it
+    void addMissingAnswers();
+
+    // wordLength letters, all of them in the alphabet
+    bool isPlayableWord(std::string_view word) const;
+
+    void buildAnswerSampler(const std::filesystem::path &pathToFrequencies);
+
+    void buildWordLetters();
+
+    void buildEytzingerKeys(std::vector<std::uint64_t> sortedKeys);
+
+    static size_t lowerBoundNode(size_t node);
+
+public:
+    // extraWords are allowed even if the files do not contain them, answers are always allowed;
+    // answers of another length or outside of the alphabet are dropped
+    WordIndex(const WordListPaths &paths, Alphabet::Language lang, int wordLength,
+              std::span<const std::string> extraWords = {});
+
+    // words of static storage, e.g. compiled into the executable; every word is an answer
+    WordIndex(std::span<const std::string_view> allowedWords, Alphabet::Language lang, int wordLength);
+
+    size_t getWordsCount() const { return words.size(); }
+
+    std::string_view getWord(size_t wordNumber) const { return words[wordNumber]; }
+
+    size_t getAnswersCount() const { return answers.size(); }
+
+    std::string_view getAnswer(size_t answerNumber) const { return answers[answerNumber]; }
+
+    // answer weighted by its corpus frequency, randomBits are 64 uniformly random bits
+    std::string_view sampleAnswer(std::uint64_t randomBits) const { return answers[answerSampler.sample(randomBits)]; }
+
+    const LetterCodec &getLetterCodec() const { return letterCodec; }
+
+    int getWordLength() const { return wordLength; }
+
+    // letter indices of the words spelled in the alphabet, getWordLength() per word
+    std::span<const std::uint8_t> getWordLetters() const { return wordLetters; }
+
+    // number (for getWord) of the block-th word of getWordLetters()
+    size_t getLettersWordNumber(size_t block) const { return lettersWordNumbers[block]; }
+
+    // blocks of getWordLetters() that can be the target, in increasing order
+    std::span<const std::uint32_t> getAnswerBlocks() const { return answerBlocks; }
+
+    bool containsWord(std::string_view word) const;
+
+    bool containsKey(std::uint64_t key) const;
+
+    // batch membership, results[i] is set for candidates[i]
+    void containsKeys(std::span<const std::uint64_t> keys, std::span<bool> results) const;
+
+    void areValidWords(std::span<const std::string_view> candidates, std::span<bool> results) const;
+
+    // up to maxCount words within maxDistance edits of word, closest first
+    std::vector<std::string_view> findClosestWords(std::string_view word, size_t maxCount, int maxDistance) const;
+
+    // approximate resident size of the word list and its index
+    size_t getMemoryUsage() const;
+
+    WordIndex(const WordIndex &other) = delete;
+
+    WordIndex &operator=(const WordIndex &other) = delete;
+};
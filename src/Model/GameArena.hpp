@@ -0,0 +1,30 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+// Memory of one game: a fixed buffer handed out by a monotonic resource and rewound between
+// games, so a restart makes no allocator calls and a long session does not fragment the heap.
+// What does not fit goes to the heap and is given back on the next reset.
+class GameArena
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 4096;
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, BUFFER_SIZE> buffer;
+    std::pmr::monotonic_buffer_resource resource;
+
+public:
+    GameArena() : resource(buffer.data(), buffer.size(), std::pmr::new_delete_resource()) {}
+
+    std::pmr::memory_resource *getResource() { return &resource; }
+
+    // every container of the arena must have dropped its memory before
+    void reset() { resource.release(); }
+
+    GameArena(const GameArena &other) = delete;
+
+    GameArena &operator=(const GameArena &other) = delete;
+};
@@ -0,0 +1,43 @@
+#include "GameModelFactory.hpp"
+#include "AdversarialModel.hpp"
+#include "Dictionary/Dictionary.hpp"
+#include "Dictionary/DictionaryRegistry.hpp"
+#include "Dictionary/EmbeddedDictionary.hpp"
+#include "Dictionary/RegisteredDictionary.hpp"
+#include "WordleModel.hpp"
+#include <memory>
+#include <stdexcept>
+
+std::unique_ptr<IGameModel> GameModelFactory::create(Alphabet::Language lang, int wordLength, int maxAttempts,
+                                                     GameMode mode)
+{
+    if (wordLength < MIN_WORD_LENGTH || wordLength > MAX_WORD_LENGTH)
+    {
+        throw std::invalid_argument("Неподдерживаемая длина слова!");
+    }
+    if (maxAttempts < 1 || maxAttempts > GameStateDTO::MAX_ATTEMPTS)
+    {
+        throw std::invalid_argument("Неподдерживаемое число попыток!");
+    }
+
+    // dictionary is loaded on a worker thread while the window and fonts come up
+    auto loadDictionary = [lang, wordLength]() -> std::unique_ptr<IDictionary>
+    {
+#ifdef WORDLE_EMBEDDED_DICTIONARIES
+        // only the allowed lists are embedded: every word is an answer, drawn without repeats
+        auto dictionary = std::make_unique<EmbeddedDictionary>(lang, wordLength);
+        dictionary->setDrawMode(Dictionary::DrawMode::SHUFFLE_BAG);
+        return dictionary;
+#else
+        auto registry = std::make_shared<DictionaryRegistry>(DictionaryRegistry::DEFAULT_MEMORY_BUDGET, true);
+        // no target repeats until every answer was played, kept for every instance the registry loads
+        registry->setDrawMode(lang, wordLength, Dictionary::DrawMode::SHUFFLE_BAG);
+        return std::make_unique<RegisteredDictionary>(registry, lang, wordLength);
+#endif
+    };
+    if (mode == GameMode::ADVERSARIAL)
+    {
+        return std::make_unique<AdversarialModel>(lang, loadDictionary, maxAttempts);
+    }
+    return std::make_unique<WordleModel>(lang, loadDictionary, maxAttempts);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+
+#include "Dictionary/Alphabet.hpp"
+#include "GameState.hpp"
+#include "IGameModel.hpp"
+#include "Solver/FeedbackScorer.hpp"
+
+// Builds the model of a game configuration behind IGameModel. Word lengths from MIN_WORD_LENGTH
+// to MAX_WORD_LENGTH have feedback scoring compiled for them (see FeedbackScorer::scoreFixed),
+// the model picks that instantiation by the length of the dictionary's words.
+class GameModelFactory
+{
+public:
+    enum class GameMode
+    {
+        CLASSIC,
+        ADVERSARIAL // no target is chosen up front, see AdversarialModel
+    };
+
+    static constexpr int MIN_WORD_LENGTH = FeedbackScorer::MIN_FIXED_LENGTH;
+    static constexpr int MAX_WORD_LENGTH = FeedbackScorer::MAX_FIXED_LENGTH;
+
+    static_assert(MAX_WORD_LENGTH <= GameStateDTO::MAX_WORD_LENGTH);
+
+    GameModelFactory() = delete;
+
+    // the dictionary is loaded in the background, see IGameModel::isReady;
+    // throws std::invalid_argument for an unsupported length or number of attempts
+    static std::unique_ptr<IGameModel> create(Alphabet::Language lang, int wordLength, int maxAttempts,
+                                              GameMode mode = GameMode::CLASSIC);
+};
@@ -1,14 +1,34 @@
 #pragma once
 
-#include <format>
-#include <map>
+#include "Dictionary/LetterCodec.hpp"
+#include "GameArena.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+// next guess proposed by the solver, no hint if the word is empty
+struct GameHint
+{
+    std::pmr::string word;
+    double expectedRemaining = 0.0; // candidates left after the guess, averaged over the targets
+    double searchProgress = 1.0;    // share of the guesses rated, below 1 while the search runs or if it stopped early
+};
+
+// State of one game on letter ids of the language's LetterCodec: words and statuses live in
+// fixed arrays, so typing and guessing do not allocate. UTF-8 text is kept only where it is
+// shown as is (the typed input and the messages), the views decode letter ids for display.
+// The messages live in the state's GameArena; reset() clears everything in place and rewinds it.
 struct GameStateDTO
 {
-    enum class LetterStatus
+    enum class LetterStatus : std::uint8_t
     {
         IS_NOT_USED,
         IS_NOT_IN_WORD,
@@ -16,57 +36,114 @@ struct GameStateDTO
         IS_IN_PLACE
     };
 
+    using LetterId = std::uint8_t;
+
+    static constexpr LetterId NO_LETTER = LetterCodec::INVALID_LETTER;
+    static constexpr int MAX_WORD_LENGTH = 12;
+    static constexpr int MAX_ATTEMPTS = 8;
+    static constexpr size_t MAX_LETTERS = 64;
+    static constexpr size_t MAX_SUGGESTIONS = 3;
+    static constexpr size_t MESSAGE_CAPACITY = 128; // reserved for the messages, they are rewritten in place
+
+    static constexpr std::string_view WIN_MESSAGE = "ПОБЕДА!";
+    static constexpr std::string_view LOSE_MESSAGE = "Поражение. Слово было: ";
+
+    using Word = std::array<LetterId, MAX_WORD_LENGTH>;
+
+    struct Guess
+    {
+        Word letters;
+        std::array<LetterStatus, MAX_WORD_LENGTH> statuses;
+        std::uint32_t patternCode; // base-3 feedback, see FeedbackScorer
+    };
+
+    const LetterCodec *letterCodec;
+
     bool isGameFinished;
+    bool isHardMode = false; // every guess uses the hints revealed so far, kept across games
     int targetWordLength;
     int maxAttempts;
+    int guessesCount;
+    int currentInputLength; // letters typed, including ones outside of the alphabet
 
-    std::string targetWord;
-    std::vector<std::string> currentInputByLetters;
-    std::vector<std::string> targetWordByLetters;
-
-    std::string currentAlphabet;
-    std::map<std::string, LetterStatus> currentAlphabetStatus;
+    Word targetWord;
+    Word currentInput; // NO_LETTER for a character outside of the alphabet
+    std::array<Guess, MAX_ATTEMPTS> guesses;
+    std::array<LetterStatus, MAX_LETTERS> letterStatuses; // keyboard, indexed by letter id
+    int remainingCandidatesCount = -1;                     // answers consistent with the feedback, -1 if unknown
 
-    std::vector<std::string> userGuesses;
-    std::vector<std::pair<std::string, LetterStatus>> lastGuessStatus;
-    std::vector<std::vector<std::pair<std::string, LetterStatus>>> userGuessesStatuses;
+    std::string currentInputText; // the typed input as is, for display
 
-    std::string errorMessage;
-    std::string finalMessage;
+    std::unique_ptr<GameArena> arena; // per-game memory of the messages below
+    std::pmr::string errorMessage;
+    std::pmr::vector<std::pmr::string> suggestions; // closest dictionary words to the last rejected guess
+    GameHint hint;
+    std::pmr::string finalMessage;
 
-    std::string WIN_MESSAGE = "ПОБЕДА!";
-    std::string LOSE_MESSAGE;
+    GameStateDTO(int _maxAttempts, const LetterCodec &_letterCodec,
+                 std::string_view _wordToGuess) : letterCodec(&_letterCodec), isGameFinished(false),
+                                                  targetWordLength(0), maxAttempts(_maxAttempts),
+                                                  guessesCount(0), currentInputLength(0),
+                                                  targetWord{}, currentInput{}, guesses{}, letterStatuses{},
+                                                  arena(std::make_unique<GameArena>()),
+                                                  errorMessage(arena->getResource()),
+                                                  suggestions(arena->getResource()),
+                                                  hint{std::pmr::string(arena->getResource())},
+                                                  finalMessage(arena->getResource())
+    {
+        if (maxAttempts < 1 || maxAttempts > MAX_ATTEMPTS || letterCodec->getLettersCount() > MAX_LETTERS)
+        {
+            throw std::invalid_argument("Неподдерживаемые параметры игры!");
+        }
+        currentInputText.reserve(MAX_WORD_LENGTH * 4);
+        reset(_wordToGuess);
+    }
 
-    GameStateDTO(int _maxAttempts, std::string _currentAlphabet,
-                 std::string _wordToGuess) : isGameFinished(false), maxAttempts(_maxAttempts),
-                                             targetWord(std::move(_wordToGuess)),
-                                             currentAlphabet(std::move(_currentAlphabet)),
-                                             LOSE_MESSAGE(std::format("Поражение. Слово было: {}", targetWord))
+    // a new game in place: no allocator calls, the arena is rewound
+    void reset(std::string_view wordToGuess)
     {
-        targetWordLength = countUnicodeCharacters(targetWord);
-        targetWordByLetters = splitUtf8IntoCharacters(targetWord);
-        std::vector<std::string> tempAlpha = splitUtf8IntoCharacters(currentAlphabet);
-        for (const std::string &chr : tempAlpha)
+        releaseMessages();
+        arena->reset();
+        errorMessage.reserve(MESSAGE_CAPACITY);
+        suggestions.reserve(MAX_SUGGESTIONS);
+        hint.word.reserve(MAX_WORD_LENGTH * 4);
+        finalMessage.reserve(MESSAGE_CAPACITY);
+
+        isGameFinished = false;
+        guessesCount = 0;
+        remainingCandidatesCount = -1;
+        hint.expectedRemaining = 0.0;
+        hint.searchProgress = 1.0;
+        letterStatuses.fill(LetterStatus::IS_NOT_USED);
+        setCurrentInput({});
+
+        targetWordLength = encodeWord(wordToGuess, targetWord);
+        if (targetWordLength > MAX_WORD_LENGTH)
         {
-            currentAlphabetStatus[chr] = LetterStatus::IS_NOT_USED;
+            throw std::invalid_argument("Слишком длинное загаданное слово!");
         }
     }
 
-    GameStateDTO(GameStateDTO &&other) noexcept : isGameFinished(other.isGameFinished),
+    // the arena moves along with the messages it holds, so moving never allocates; other is left
+    // without an arena and can only be assigned to or destroyed
+    GameStateDTO(GameStateDTO &&other) noexcept : letterCodec(other.letterCodec),
+                                                  isGameFinished(other.isGameFinished),
+                                                  isHardMode(other.isHardMode),
                                                   targetWordLength(other.targetWordLength),
                                                   maxAttempts(other.maxAttempts),
-                                                  targetWord(std::move(other.targetWord)),
-                                                  currentInputByLetters(std::move(other.currentInputByLetters)),
-                                                  targetWordByLetters(std::move(other.targetWordByLetters)),
-                                                  currentAlphabet(std::move(other.currentAlphabet)),
-                                                  currentAlphabetStatus(std::move(other.currentAlphabetStatus)),
-                                                  userGuesses(std::move(other.userGuesses)),
-                                                  lastGuessStatus(std::move(other.lastGuessStatus)),
-                                                  userGuessesStatuses(std::move(other.userGuessesStatuses)),
+                                                  guessesCount(other.guessesCount),
+                                                  currentInputLength(other.currentInputLength),
+                                                  targetWord(other.targetWord),
+                                                  currentInput(other.currentInput),
+                                                  guesses(other.guesses),
+                                                  letterStatuses(other.letterStatuses),
+                                                  remainingCandidatesCount(other.remainingCandidatesCount),
+                                                  currentInputText(std::move(other.currentInputText)),
+                                                  arena(std::move(other.arena)),
                                                   errorMessage(std::move(other.errorMessage)),
-                                                  finalMessage(std::move(other.finalMessage)),
-                                                  WIN_MESSAGE(other.WIN_MESSAGE),
-                                                  LOSE_MESSAGE(other.LOSE_MESSAGE)
+                                                  suggestions(std::move(other.suggestions)),
+                                                  hint(std::move(other.hint)),
+                                                  finalMessage(std::move(other.finalMessage))
     {
     }
 
@@ -74,102 +151,164 @@ struct GameStateDTO
     {
         if (this != &other)
         {
+            std::swap(letterCodec, other.letterCodec);
+
             std::swap(isGameFinished, other.isGameFinished);
+            std::swap(isHardMode, other.isHardMode);
             std::swap(targetWordLength, other.targetWordLength);
             std::swap(maxAttempts, other.maxAttempts);
+            std::swap(guessesCount, other.guessesCount);
+            std::swap(currentInputLength, other.currentInputLength);
 
             std::swap(targetWord, other.targetWord);
-            std::swap(currentInputByLetters, other.currentInputByLetters);
-            std::swap(targetWordByLetters, other.targetWordByLetters);
+            std::swap(currentInput, other.currentInput);
+            std::swap(guesses, other.guesses);
+            std::swap(letterStatuses, other.letterStatuses);
+            std::swap(remainingCandidatesCount, other.remainingCandidatesCount);
 
-            std::swap(currentAlphabet, other.currentAlphabet);
-            std::swap(currentAlphabetStatus, other.currentAlphabetStatus);
+            // the arenas are swapped together with the messages living in them
+            std::swap(currentInputText, other.currentInputText);
+            std::swap(arena, other.arena);
+            swapWithAllocator(errorMessage, other.errorMessage);
+            swapWithAllocator(suggestions, other.suggestions);
+            swapWithAllocator(hint, other.hint);
+            swapWithAllocator(finalMessage, other.finalMessage);
+        }
+        return *this;
+    }
 
-            std::swap(userGuesses, other.userGuesses);
-            std::swap(lastGuessStatus, other.lastGuessStatus);
-            std::swap(userGuessesStatuses, other.userGuessesStatuses);
+    void setHint(std::string_view word, double expectedRemaining, double searchProgress = 1.0)
+    {
+        hint.word.assign(word);
+        hint.expectedRemaining = expectedRemaining;
+        hint.searchProgress = searchProgress;
+    }
 
-            std::swap(errorMessage, other.errorMessage);
-            std::swap(finalMessage, other.finalMessage);
+    void clearHint()
+    {
+        setHint({}, 0.0);
+    }
 
-            std::swap(WIN_MESSAGE, other.WIN_MESSAGE);
-            std::swap(LOSE_MESSAGE, other.LOSE_MESSAGE);
-        }
-        return *this;
+    void setCurrentInput(std::string_view input)
+    {
+        currentInputText.assign(input);
+        currentInputLength = encodeWord(input, currentInput);
     }
 
-    void setCurrentInput(const std::string &input)
+    [[nodiscard]] const std::string &getCurrentInputString() const
     {
-        currentInputByLetters = splitUtf8IntoCharacters(input);
+        return currentInputText;
     }
 
-    [[nodiscard]] const std::string getCurrentInputString() const
+    [[nodiscard]] std::span<const LetterId> getTargetLetters() const
     {
-        std::string res;
-        for (const auto &let : currentInputByLetters)
-        {
-            res += let;
-        }
-        return res;
+        return std::span(targetWord).first(targetWordLength);
     }
 
-    [[nodiscard]] const std::vector<std::string> getUserGuessByLetters(int index) const
+    [[nodiscard]] std::span<const LetterId> getCurrentInputLetters() const
     {
-        return splitUtf8IntoCharacters(userGuesses[index]);
+        return std::span(currentInput).first(std::min(currentInputLength, MAX_WORD_LENGTH));
     }
 
-    GameStateDTO(const GameStateDTO &other) = delete;
+    [[nodiscard]] std::span<const LetterId> getGuessLetters(int index) const
+    {
+        return std::span(guesses[index].letters).first(targetWordLength);
+    }
 
-    GameStateDTO &operator=(const GameStateDTO &other) = delete;
+    [[nodiscard]] std::span<const LetterStatus> getGuessStatuses(int index) const
+    {
+        return std::span(guesses[index].statuses).first(targetWordLength);
+    }
 
-private:
-    // utils for utf8 strings
+    [[nodiscard]] LetterStatus getLetterStatus(LetterId letter) const
+    {
+        return letter < letterStatuses.size() ? letterStatuses[letter] : LetterStatus::IS_NOT_USED;
+    }
 
-    static size_t countUnicodeCharacters(const std::string &utf8_string)
+    [[nodiscard]] size_t getLettersCount() const
     {
-        size_t count = 0;
-        for (char c : utf8_string)
-        {
-            auto uc = static_cast<unsigned char>(c);
+        return letterCodec->getLettersCount();
+    }
 
-            if ((uc & 0xC0) != 0x80)
+    // utf-8 text of letter ids, skips the ones outside of the alphabet
+    template <typename String>
+    void appendWord(String &text, std::span<const LetterId> letters) const
+    {
+        for (LetterId letter : letters)
+        {
+            if (letter != NO_LETTER)
             {
-                count++;
+                std::array<char, 4> bytes{};
+                text.append(bytes.data(), LetterCodec::encodeUtf8(letterCodec->getLetter(letter), bytes));
             }
         }
-        return count;
     }
 
-    static std::vector<std::string> splitUtf8IntoCharacters(const std::string &utf8_string)
+    // capital form of a letter from the alphabet table, for the keyboard
+    [[nodiscard]] std::string_view getUpperLetter(LetterId letter) const
     {
-        std::vector<std::string> characters;
-        if (utf8_string.empty())
-        {
-            return characters;
-        }
+        return letterCodec->getUpperLetter(letter);
+    }
 
-        size_t startIndex = 0;
+    // allocates, meant for display
+    [[nodiscard]] std::string decodeWord(std::span<const LetterId> letters) const
+    {
+        std::string word;
+        appendWord(word, letters);
+        return word;
+    }
 
-        for (size_t i = 0; i < utf8_string.length(); ++i)
-        {
-            auto currentByte = static_cast<unsigned char>(utf8_string[i]);
+    [[nodiscard]] std::string getTargetWordString() const
+    {
+        return decodeWord(getTargetLetters());
+    }
 
-            bool isContinuationByte = (currentByte & 0xC0) == 0x80;
+    [[nodiscard]] std::string getGuessString(int index) const
+    {
+        return decodeWord(getGuessLetters(index));
+    }
 
-            if (i > 0 && !isContinuationByte)
-            {
-                std::string character = utf8_string.substr(startIndex, i - startIndex);
-                characters.push_back(character);
-                startIndex = i;
-            }
-        }
+    GameStateDTO(const GameStateDTO &other) = delete;
 
-        if (startIndex < utf8_string.length())
+    GameStateDTO &operator=(const GameStateDTO &other) = delete;
+
+private:
+    // std::swap of pmr containers on different arenas copies their elements, and their swap()
+    // keeps the allocators; move construction takes the allocator along and never allocates
+    template <typename Value>
+    static void swapWithAllocator(Value &first, Value &second) noexcept
+    {
+        Value firstValue(std::move(first));
+        std::destroy_at(&first);
+        std::construct_at(&first, std::move(second));
+        std::destroy_at(&second);
+        std::construct_at(&second, std::move(firstValue));
+    }
+
+    // the containers give their memory back before the arena is rewound
+    void releaseMessages()
+    {
+        std::pmr::string(arena->getResource()).swap(errorMessage);
+        std::pmr::vector<std::pmr::string>(arena->getResource()).swap(suggestions);
+        std::pmr::string(arena->getResource()).swap(hint.word);
+        std::pmr::string(arena->getResource()).swap(finalMessage);
+    }
+
+    // letter ids of up to MAX_WORD_LENGTH characters, returns the number of characters
+    int encodeWord(std::string_view text, Word &letters) const
+    {
+        letters.fill(NO_LETTER);
+        int length = 0;
+        size_t position = 0;
+        while (position < text.size())
         {
-            std::string lastCharacter = utf8_string.substr(startIndex);
-            characters.push_back(lastCharacter);
+            const LetterId letter = letterCodec->getLetterIndex(LetterCodec::decodeUtf8(text, position));
+            if (length < MAX_WORD_LENGTH)
+            {
+                letters[length] = letter;
+            }
+            length++;
         }
-
-        return characters;
+        return length;
     }
-};
\ No newline at end of file
+};
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "GameState.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+
+// Hints that every guess of the hard mode must use: a letter found in place stays there, and a
+// letter found in the word appears again, as many times as one guess has shown it. They are kept
+// as bitmasks over letter ids, updated once per guess, so a check takes a few bit operations per
+// letter of the guess whatever the length of the history.
+class HardModeRules
+{
+public:
+    using LetterMask = std::uint64_t; // bit per letter id
+    using LetterId = GameStateDTO::LetterId;
+
+    static_assert(GameStateDTO::MAX_LETTERS <= 64, "a letter mask holds every letter of the alphabet");
+
+    enum class Violation
+    {
+        NONE,
+        LETTER_NOT_IN_PLACE, // a letter found in place is replaced
+        LETTER_MISSING       // a letter found in the word has too few copies
+    };
+
+    struct Check
+    {
+        Violation violation = Violation::NONE;
+        LetterId letter = 0;
+        int position = 0; // of LETTER_NOT_IN_PLACE
+        int copies = 0;   // needed of LETTER_MISSING
+    };
+
+private:
+    // letters allowed at a position: all, or the one found there
+    std::array<LetterMask, GameStateDTO::MAX_WORD_LENGTH> allowedAtPosition;
+    // letters needed at least k + 1 times, each mask is a subset of the previous one
+    std::array<LetterMask, GameStateDTO::MAX_WORD_LENGTH> requiredCopies;
+    int requiredLayersCount; // masks of requiredCopies in use
+
+    // copies of the letters at the positions of the bits of positions, layer k holds the letters
+    // seen at least k + 1 times; returns the number of non-empty layers
+    static int countCopies(std::span<const LetterId> letters, std::uint32_t positions,
+                           std::array<LetterMask, GameStateDTO::MAX_WORD_LENGTH> &layers)
+    {
+        layers.fill(0);
+        int layersCount = 0;
+        for (size_t position = 0; position < letters.size(); ++position)
+        {
+            if (((positions >> position) & 1U) == 0)
+            {
+                continue;
+            }
+            const LetterMask letter = LetterMask{1} << letters[position];
+            int layer = 0;
+            while ((layers[layer] & letter) != 0)
+            {
+                ++layer;
+            }
+            layers[layer] |= letter;
+            layersCount = layer >= layersCount ? layer + 1 : layersCount;
+        }
+        return layersCount;
+    }
+
+public:
+    HardModeRules() { reset(); }
+
+    void reset()
+    {
+        allowedAtPosition.fill(~LetterMask{0});
+        requiredCopies.fill(0);
+        requiredLayersCount = 0;
+    }
+
+    // takes the hints of a scored guess
+    void addGuess(std::span<const LetterId> letters, std::span<const GameStateDTO::LetterStatus> statuses)
+    {
+        using LetterStatus = GameStateDTO::LetterStatus;
+
+        std::uint32_t foundPositions = 0;
+        for (size_t position = 0; position < letters.size(); ++position)
+        {
+            if (statuses[position] == LetterStatus::IS_IN_PLACE || statuses[position] == LetterStatus::IS_IN_WORD_NOT_IN_PLACE)
+            {
+                foundPositions |= 1U << position;
+            }
+        }
+
+        std::array<LetterMask, GameStateDTO::MAX_WORD_LENGTH> foundCopies{};
+        const int layersCount = countCopies(letters, foundPositions, foundCopies);
+        for (int layer = 0; layer < layersCount; ++layer)
+        {
+            requiredCopies[layer] |= foundCopies[layer];
+        }
+        requiredLayersCount = layersCount > requiredLayersCount ? layersCount : requiredLayersCount;
+
+        for (size_t position = 0; position < letters.size(); ++position)
+        {
+            if (statuses[position] == LetterStatus::IS_IN_PLACE)
+            {
+                allowedAtPosition[position] = LetterMask{1} << letters[position];
+            }
+        }
+    }
+
+    // letters must be letter ids of the alphabet
+    Check check(std::span<const LetterId> letters) const
+    {
+        for (size_t position = 0; position < letters.size(); ++position)
+        {
+            if ((allowedAtPosition[position] & (LetterMask{1} << letters[position])) == 0)
+            {
+                return {Violation::LETTER_NOT_IN_PLACE, static_cast<LetterId>(std::countr_zero(allowedAtPosition[position])),
+                        static_cast<int>(position), 0};
+            }
+        }
+
+        std::array<LetterMask, GameStateDTO::MAX_WORD_LENGTH> guessCopies{};
+        countCopies(letters, ~std::uint32_t{0}, guessCopies);
+        for (int layer = 0; layer < requiredLayersCount; ++layer)
+        {
+            if (const LetterMask missing = requiredCopies[layer] & ~guessCopies[layer]; missing != 0)
+            {
+                return {Violation::LETTER_MISSING, static_cast<LetterId>(std::countr_zero(missing)), 0, layer + 1};
+            }
+        }
+        return {};
+    }
+};
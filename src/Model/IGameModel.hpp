@@ -1,12 +1,25 @@
 #pragma once
 
+#include <chrono>
+#include <exception>
+#include <future>
 #include <string>
 
+#include "Dictionary/IDictionary.hpp"
 #include "GameState.hpp"
 
 class IGameModel
 {
 public:
+    // false while the dictionary is still loading, finishes initialization once it is done;
+    // does not throw, a failed load keeps returning false and is reported by getLoadingError()
+    virtual bool isReady() = 0;
+
+    [[nodiscard]] virtual std::shared_future<void> getReadyFuture() const = 0;
+
+    // why the dictionary could not be loaded, nullptr while it loads or once it is ready
+    [[nodiscard]] virtual std::exception_ptr getLoadingError() const = 0;
+
     virtual void startNewGame() = 0;
 
     virtual void checkInputWord() = 0;
@@ -21,5 +34,20 @@ public:
 
     [[nodiscard]] virtual GameStateDTO &getGameState() = 0;
 
+    // in hard mode a guess must keep the letters found in place and reuse the letters found in
+    // the word; can be switched during a game, the hints of the guesses played so far apply
+    virtual void setHardMode(bool isEnabled) = 0;
+
+    virtual bool isHardMode() const = 0;
+
+    [[nodiscard]] virtual DictionaryReloadStats getDictionaryReloadStats() const = 0;
+
+    // starts looking for the guess that narrows the remaining candidates the most, without
+    // waiting for it; typing, a new guess or a new game cancel the search
+    virtual void requestHint(std::chrono::milliseconds timeBudget) = 0;
+
+    // best hint found so far, also stored in the game state; cheap enough to poll every frame
+    virtual const GameHint &getHint() = 0;
+
     virtual ~IGameModel() = default;
 };
\ No newline at end of file
@@ -0,0 +1,322 @@
+#include "BatchScorer.hpp"
+#include <array>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define BATCH_SCORER_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BATCH_SCORER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define BATCH_SCORER_TARGET_AVX2
+#endif
+
+// Per target word the feedback is computed without a counting table, so all lanes run the same
+// instructions: letter i of the guess is green if it matches, and yellow if the target has more
+// non-green copies of it than there are non-green copies earlier in the guess.
+// This gives exactly the left-to-right assignment of FeedbackScorer.
+// Every kernel is instantiated per word length, so its position loops have fixed trip counts and
+// unroll; LENGTH 0 is the generic instantiation that reads the length of the guess at runtime.
+
+namespace
+{
+constexpr std::uint8_t PADDING_LETTER = 0xFF; // never a valid letter index
+
+struct GuessLayout
+{
+    int length = 0;
+    std::array<std::uint8_t, BatchScorer::MAX_WORD_LENGTH> letters{};
+    // bit k of earlierCopies[i] is set if guess letter k < i equals letter i
+    std::array<std::uint32_t, BatchScorer::MAX_WORD_LENGTH> earlierCopies{};
+};
+
+GuessLayout makeGuessLayout(std::span<const std::uint8_t> guess)
+{
+    GuessLayout layout;
+    layout.length = static_cast<int>(guess.size());
+    for (int i = 0; i < layout.length; ++i)
+    {
+        layout.letters[i] = guess[i];
+        for (int k = 0; k < i; ++k)
+        {
+            if (guess[k] == guess[i])
+            {
+                layout.earlierCopies[i] |= 1U << k;
+            }
+        }
+    }
+    return layout;
+}
+
+template <int LENGTH>
+void scoreScalar(const GuessLayout &guess, const std::uint8_t *columns, size_t columnStride,
+                 size_t firstWord, size_t wordsCount, std::uint8_t *output)
+{
+    const int length = LENGTH > 0 ? LENGTH : guess.length;
+    for (size_t n = 0; n < wordsCount; ++n)
+    {
+        std::array<std::uint8_t, BatchScorer::MAX_WORD_LENGTH> target{};
+        std::array<bool, BatchScorer::MAX_WORD_LENGTH> isGreen{};
+        for (int p = 0; p < length; ++p)
+        {
+            target[p] = columns[p * columnStride + firstWord + n];
+            isGreen[p] = target[p] == guess.letters[p];
+        }
+
+        std::uint8_t code = 0;
+        for (int i = length - 1; i >= 0; --i)
+        {
+            std::uint8_t digit = 2;
+            if (!isGreen[i])
+            {
+                int available = 0;
+                int used = 0;
+                for (int j = 0; j < length; ++j)
+                {
+                    available += (!isGreen[j] && target[j] == guess.letters[i]) ? 1 : 0;
+                    used += (!isGreen[j] && (guess.earlierCopies[i] >> j) & 1U) ? 1 : 0;
+                }
+                digit = available > used ? 1 : 0;
+            }
+            code = static_cast<std::uint8_t>(code * 3 + digit);
+        }
+        output[n] = code;
+    }
+}
+
+#ifdef BATCH_SCORER_X86
+
+// masks are 0xFF for true, subtracting a mask counts it
+template <int LENGTH>
+size_t scoreSse2(const GuessLayout &guess, const std::uint8_t *columns, size_t columnStride,
+                 size_t firstWord, size_t wordsCount, std::uint8_t *output)
+{
+    constexpr size_t LANES = 16;
+    const int length = LENGTH > 0 ? LENGTH : guess.length;
+    const __m128i ones = _mm_set1_epi8(1);
+    const __m128i twos = _mm_set1_epi8(2);
+    const __m128i allSet = _mm_set1_epi8(-1);
+
+    __m128i guessLetters[BatchScorer::MAX_WORD_LENGTH]{};
+    for (int p = 0; p < length; ++p)
+    {
+        guessLetters[p] = _mm_set1_epi8(static_cast<char>(guess.letters[p]));
+    }
+
+    size_t n = 0;
+    for (; n + LANES <= wordsCount; n += LANES)
+    {
+        __m128i target[BatchScorer::MAX_WORD_LENGTH]{};
+        __m128i green[BatchScorer::MAX_WORD_LENGTH]{};
+        __m128i notGreen[BatchScorer::MAX_WORD_LENGTH]{};
+        for (int p = 0; p < length; ++p)
+        {
+            target[p] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(columns + (p * columnStride) + firstWord + n));
+            green[p] = _mm_cmpeq_epi8(target[p], guessLetters[p]);
+            notGreen[p] = _mm_andnot_si128(green[p], allSet);
+        }
+
+        __m128i code = _mm_setzero_si128();
+        for (int i = length - 1; i >= 0; --i)
+        {
+            __m128i available = _mm_setzero_si128();
+            __m128i used = _mm_setzero_si128();
+            for (int j = 0; j < length; ++j)
+            {
+                available = _mm_sub_epi8(available, _mm_and_si128(notGreen[j], _mm_cmpeq_epi8(target[j], guessLetters[i])));
+                if ((guess.earlierCopies[i] >> j) & 1U)
+                {
+                    used = _mm_sub_epi8(used, notGreen[j]);
+                }
+            }
+            const __m128i yellow = _mm_and_si128(notGreen[i], _mm_cmpgt_epi8(available, used));
+            const __m128i digit = _mm_or_si128(_mm_and_si128(green[i], twos), _mm_and_si128(yellow, ones));
+            code = _mm_add_epi8(_mm_add_epi8(code, _mm_add_epi8(code, code)), digit);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + n), code);
+    }
+    return n;
+}
+
+template <int LENGTH>
+BATCH_SCORER_TARGET_AVX2
+size_t scoreAvx2(const GuessLayout &guess, const std::uint8_t *columns, size_t columnStride,
+                 size_t firstWord, size_t wordsCount, std::uint8_t *output)
+{
+    constexpr size_t LANES = 32;
+    const int length = LENGTH > 0 ? LENGTH : guess.length;
+    const __m256i ones = _mm256_set1_epi8(1);
+    const __m256i twos = _mm256_set1_epi8(2);
+    const __m256i allSet = _mm256_set1_epi8(-1);
+
+    __m256i guessLetters[BatchScorer::MAX_WORD_LENGTH]{};
+    for (int p = 0; p < length; ++p)
+    {
+        guessLetters[p] = _mm256_set1_epi8(static_cast<char>(guess.letters[p]));
+    }
+
+    size_t n = 0;
+    for (; n + LANES <= wordsCount; n += LANES)
+    {
+        __m256i target[BatchScorer::MAX_WORD_LENGTH]{};
+        __m256i green[BatchScorer::MAX_WORD_LENGTH]{};
+        __m256i notGreen[BatchScorer::MAX_WORD_LENGTH]{};
+        for (int p = 0; p < length; ++p)
+        {
+            target[p] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(columns + (p * columnStride) + firstWord + n));
+            green[p] = _mm256_cmpeq_epi8(target[p], guessLetters[p]);
+            notGreen[p] = _mm256_andnot_si256(green[p], allSet);
+        }
+
+        __m256i code = _mm256_setzero_si256();
+        for (int i = length - 1; i >= 0; --i)
+        {
+            __m256i available = _mm256_setzero_si256();
+            __m256i used = _mm256_setzero_si256();
+            for (int j = 0; j < length; ++j)
+            {
+                available = _mm256_sub_epi8(available, _mm256_and_si256(notGreen[j], _mm256_cmpeq_epi8(target[j], guessLetters[i])));
+                if ((guess.earlierCopies[i] >> j) & 1U)
+                {
+                    used = _mm256_sub_epi8(used, notGreen[j]);
+                }
+            }
+            const __m256i yellow = _mm256_and_si256(notGreen[i], _mm256_cmpgt_epi8(available, used));
+            const __m256i digit = _mm256_or_si256(_mm256_and_si256(green[i], twos), _mm256_and_si256(yellow, ones));
+            code = _mm256_add_epi8(_mm256_add_epi8(code, _mm256_add_epi8(code, code)), digit);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + n), code);
+    }
+    return n;
+}
+
+bool hasAvx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::array<int, 4> registers{};
+    __cpuid(registers.data(), 1);
+    const bool isAvxEnabledByOs = (registers[2] & (1 << 27)) != 0 && (registers[2] & (1 << 28)) != 0 &&
+                                  (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(registers.data(), 7, 0);
+    return isAvxEnabledByOs && (registers[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif
+
+using SimdKernel = size_t (*)(const GuessLayout &, const std::uint8_t *, size_t, size_t, size_t, std::uint8_t *);
+using ScalarKernel = void (*)(const GuessLayout &, const std::uint8_t *, size_t, size_t, size_t, std::uint8_t *);
+
+struct Kernels
+{
+    SimdKernel simd;     // widest kernel this CPU runs, returns how many words it scored, nullptr without SIMD
+    ScalarKernel scalar; // the rest of the words
+};
+
+template <int LENGTH>
+Kernels instantiateKernels()
+{
+#ifdef BATCH_SCORER_X86
+    static const bool isAvx2Supported = hasAvx2();
+    return {isAvx2Supported ? scoreAvx2<LENGTH> : scoreSse2<LENGTH>, scoreScalar<LENGTH>};
+#else
+    return {nullptr, scoreScalar<LENGTH>};
+#endif
+}
+
+// indexed by word length, 0 holds the generic kernels
+Kernels selectKernels(int wordLength)
+{
+    static const std::array<Kernels, BatchScorer::MAX_WORD_LENGTH + 1> kernels{
+        instantiateKernels<0>(), instantiateKernels<1>(), instantiateKernels<2>(),
+        instantiateKernels<3>(), instantiateKernels<4>(), instantiateKernels<5>()};
+    return kernels[wordLength];
+}
+} // namespace
+
+BatchScorer::BatchScorer(std::span<const std::uint8_t> wordLetters, int _wordLength, bool _isSpecialized)
+    : wordLength(_wordLength), isSpecialized(_isSpecialized)
+{
+    if (!isSupportedLength(wordLength))
+    {
+        throw std::invalid_argument("Пакетная оценка поддерживает слова длиной до " + std::to_string(MAX_WORD_LENGTH) + " букв");
+    }
+
+    wordsCount = wordLetters.size() / wordLength;
+    columnStride = ((wordsCount + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT) * COLUMN_ALIGNMENT;
+    letterColumns.assign(wordLength * columnStride, PADDING_LETTER);
+    patterns.resize(columnStride);
+
+    // transpose: row n of the input becomes column n of the matrix
+    for (size_t n = 0; n < wordsCount; ++n)
+    {
+        for (int p = 0; p < wordLength; ++p)
+        {
+            letterColumns[(p * columnStride) + n] = wordLetters[(n * wordLength) + p];
+        }
+    }
+}
+
+void BatchScorer::scoreRange(std::span<const std::uint8_t> guess, size_t firstWord, std::span<std::uint8_t> output) const
+{
+    if (static_cast<int>(guess.size()) != wordLength || firstWord + output.size() > wordsCount)
+    {
+        throw std::out_of_range("Неверная длина догадки или диапазон слов");
+    }
+
+    const GuessLayout layout = makeGuessLayout(guess);
+    const Kernels kernels = selectKernels(isSpecialized ? wordLength : 0);
+    size_t scoredCount = 0;
+    if (kernels.simd != nullptr)
+    {
+        scoredCount = kernels.simd(layout, letterColumns.data(), columnStride, firstWord, output.size(), output.data());
+    }
+    kernels.scalar(layout, letterColumns.data(), columnStride, firstWord + scoredCount, output.size() - scoredCount,
+                output.data() + scoredCount);
+}
+
+std::span<const std::uint8_t> BatchScorer::scoreAgainstAll(std::span<const std::uint8_t> guess)
+{
+    // the padded buffer lets the kernels finish without a scalar tail
+    if (static_cast<int>(guess.size()) != wordLength)
+    {
+        throw std::out_of_range("Неверная длина догадки");
+    }
+
+    const GuessLayout layout = makeGuessLayout(guess);
+    const Kernels kernels = selectKernels(isSpecialized ? wordLength : 0);
+    size_t scoredCount = 0;
+    if (kernels.simd != nullptr)
+    {
+        scoredCount = kernels.simd(layout, letterColumns.data(), columnStride, 0, columnStride, patterns.data());
+    }
+    if (scoredCount < wordsCount)
+    {
+        kernels.scalar(layout, letterColumns.data(), columnStride, scoredCount, wordsCount - scoredCount,
+                    patterns.data() + scoredCount);
+    }
+    return std::span<const std::uint8_t>(patterns).first(wordsCount);
+}
+
+std::span<const std::uint8_t> BatchScorer::scoreAgainstAll(size_t guessWordNumber)
+{
+    std::array<std::uint8_t, MAX_WORD_LENGTH> guess{};
+    getWord(guessWordNumber, guess);
+    return scoreAgainstAll(std::span<const std::uint8_t>(guess).first(wordLength));
+}
+
+void BatchScorer::getWord(size_t wordNumber, std::span<std::uint8_t> letters) const
+{
+    for (int p = 0; p < wordLength; ++p)
+    {
+        letters[p] = letterColumns[(p * columnStride) + wordNumber];
+    }
+}
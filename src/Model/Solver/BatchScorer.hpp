@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Feedback patterns of one guess against every word of a list in one call.
+// Words are stored column-major (all first letters, then all second letters...), so one
+// SIMD register holds the same position of 16 or 32 targets; AVX2 or SSE2 is picked at
+// runtime, other CPUs use the scalar loop. Codes are FeedbackScorer pattern codes in one
+// byte, which limits words to MAX_WORD_LENGTH letters. The kernels are compiled for every
+// supported length and picked by the length of the list.
+class BatchScorer
+{
+public:
+    static constexpr int MAX_WORD_LENGTH = 5; // 3^5 - 1 = 242 fits a byte
+    static constexpr size_t COLUMN_ALIGNMENT = 32;
+
+private:
+    int wordLength;
+    bool isSpecialized; // kernels compiled for wordLength, the generic ones otherwise
+    size_t wordsCount;
+    size_t columnStride; // wordsCount padded to COLUMN_ALIGNMENT
+    std::vector<std::uint8_t> letterColumns;
+    std::vector<std::uint8_t> patterns; // result buffer of scoreAgainstAll
+
+public:
+    // wordLetters holds wordLength letter indices per word, word after word;
+    // isSpecialized false keeps the generic kernels, for comparison in ScoringBenchmark
+    BatchScorer(std::span<const std::uint8_t> wordLetters, int wordLength, bool isSpecialized = true);
+
+    static bool isSupportedLength(int wordLength) { return wordLength >= 1 && wordLength <= MAX_WORD_LENGTH; }
+
+    int getWordLength() const { return wordLength; }
+
+    size_t getWordsCount() const { return wordsCount; }
+
+    // patterns[i] is the code of guess against word i, valid until the next call
+    std::span<const std::uint8_t> scoreAgainstAll(std::span<const std::uint8_t> guess);
+
+    std::span<const std::uint8_t> scoreAgainstAll(size_t guessWordNumber);
+
+    // patterns of guess against words [firstWord, firstWord + output.size()), safe to call from many threads
+    void scoreRange(std::span<const std::uint8_t> guess, size_t firstWord, std::span<std::uint8_t> output) const;
+
+    // letters of word wordNumber
+    void getWord(size_t wordNumber, std::span<std::uint8_t> letters) const;
+
+    size_t getMemoryUsage() const { return letterColumns.capacity() + patterns.capacity(); }
+};
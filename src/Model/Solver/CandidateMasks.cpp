@@ -0,0 +1,46 @@
+#include "CandidateMasks.hpp"
+#include "../Dictionary/WordIndex.hpp"
+#include <utility>
+
+CandidateMasks::CandidateMasks(std::shared_ptr<const WordIndex> _wordIndex)
+    : wordIndex(std::move(_wordIndex)),
+      wordLength(wordIndex->getWordLength()),
+      lettersCount(wordIndex->getLetterCodec().getLettersCount()),
+      wordsCount(wordIndex->getWordLetters().size() / wordLength),
+      blocksCount((wordsCount + BLOCK_BITS - 1) / BLOCK_BITS)
+{
+    positionMasks.assign(static_cast<size_t>(wordLength) * lettersCount * blocksCount, 0);
+    letterCountMasks.assign(static_cast<size_t>(lettersCount) * wordLength * blocksCount, 0);
+    answerMask.assign(blocksCount, 0);
+
+    const auto letters = wordIndex->getWordLetters();
+    std::vector<std::uint8_t> letterCounts(lettersCount, 0);
+    for (size_t word = 0; word < wordsCount; ++word)
+    {
+        const size_t block = word / BLOCK_BITS;
+        const Block bit = Block{1} << (word % BLOCK_BITS);
+
+        for (int position = 0; position < wordLength; ++position)
+        {
+            const std::uint8_t letter = letters[(word * wordLength) + position];
+            positionMasks[(((static_cast<size_t>(position) * lettersCount) + letter) * blocksCount) + block] |= bit;
+            letterCounts[letter]++;
+        }
+
+        for (int position = 0; position < wordLength; ++position)
+        {
+            const std::uint8_t letter = letters[(word * wordLength) + position];
+            // every count from 1 up to the number of copies, set once per distinct letter
+            for (int count = 1; count <= letterCounts[letter]; ++count)
+            {
+                letterCountMasks[(((static_cast<size_t>(letter) * wordLength) + count - 1) * blocksCount) + block] |= bit;
+            }
+            letterCounts[letter] = 0;
+        }
+    }
+
+    for (std::uint32_t answer : wordIndex->getAnswerBlocks())
+    {
+        answerMask[answer / BLOCK_BITS] |= Block{1} << (answer % BLOCK_BITS);
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+class WordIndex;
+
+// Bitsets over the words of a WordIndex snapshot (blocks of getWordLetters(), bit n of
+// block n / 64 is word n), built once per word list:
+//   - words with a given letter at a given position,
+//   - words with at least k copies of a given letter.
+// Every Wordle feedback is an AND of some of them or of their complements (see CandidateSet).
+class CandidateMasks
+{
+public:
+    using Block = std::uint64_t;
+    static constexpr size_t BLOCK_BITS = 64;
+
+private:
+    std::shared_ptr<const WordIndex> wordIndex;
+    int wordLength;
+    int lettersCount;
+    size_t wordsCount;
+    size_t blocksCount;
+
+    std::vector<Block> positionMasks;    // (position * lettersCount + letter) * blocksCount
+    std::vector<Block> letterCountMasks; // (letter * wordLength + count - 1) * blocksCount
+    std::vector<Block> answerMask;
+
+public:
+    explicit CandidateMasks(std::shared_ptr<const WordIndex> wordIndex);
+
+    const std::shared_ptr<const WordIndex> &getWordIndex() const { return wordIndex; }
+
+    int getWordLength() const { return wordLength; }
+
+    int getLettersCount() const { return lettersCount; }
+
+    size_t getWordsCount() const { return wordsCount; }
+
+    size_t getBlocksCount() const { return blocksCount; }
+
+    std::span<const Block> getPositionMask(int position, std::uint8_t letter) const
+    {
+        return {positionMasks.data() + (((static_cast<size_t>(position) * lettersCount) + letter) * blocksCount), blocksCount};
+    }
+
+    // count from 1 to getWordLength()
+    std::span<const Block> getLetterCountMask(std::uint8_t letter, int count) const
+    {
+        return {letterCountMasks.data() + (((static_cast<size_t>(letter) * wordLength) + count - 1) * blocksCount), blocksCount};
+    }
+
+    // words that can be the target
+    std::span<const Block> getAnswerMask() const { return answerMask; }
+
+    size_t getMemoryUsage() const
+    {
+        return (positionMasks.capacity() + letterCountMasks.capacity() + answerMask.capacity()) * sizeof(Block);
+    }
+
+    CandidateMasks(const CandidateMasks &other) = delete;
+
+    CandidateMasks &operator=(const CandidateMasks &other) = delete;
+};
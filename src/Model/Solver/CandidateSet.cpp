@@ -0,0 +1,146 @@
+#include "CandidateSet.hpp"
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+// one AND of the narrowing: block &= mask ^ invert
+struct MaskConstraint
+{
+    const CandidateMasks::Block *mask;
+    CandidateMasks::Block invert;
+};
+
+// a position and a count bound per letter at most
+constexpr size_t MAX_CONSTRAINTS = 3 * FeedbackScorer::MAX_WORD_LENGTH;
+} // namespace
+
+CandidateSet::CandidateSet() : count(0)
+{
+}
+
+CandidateSet::CandidateSet(std::shared_ptr<const CandidateMasks> _masks) : count(0)
+{
+    reset(std::move(_masks));
+}
+
+void CandidateSet::reset(std::shared_ptr<const CandidateMasks> _masks)
+{
+    masks = std::move(_masks);
+    bits.clear();
+    aliveBlocks.clear();
+    count = 0;
+    if (!masks)
+    {
+        return;
+    }
+
+    const auto answerMask = masks->getAnswerMask();
+    bits.assign(answerMask.begin(), answerMask.end());
+    for (size_t block = 0; block < bits.size(); ++block)
+    {
+        if (bits[block] != 0)
+        {
+            aliveBlocks.push_back(static_cast<std::uint32_t>(block));
+            count += std::popcount(bits[block]);
+        }
+    }
+}
+
+bool CandidateSet::contains(size_t wordNumber) const
+{
+    return wordNumber / CandidateMasks::BLOCK_BITS < bits.size() &&
+           ((bits[wordNumber / CandidateMasks::BLOCK_BITS] >> (wordNumber % CandidateMasks::BLOCK_BITS)) & 1) != 0;
+}
+
+void CandidateSet::narrow(std::span<const std::uint8_t> guess, std::span<const FeedbackScorer::Feedback> feedback)
+{
+    using Feedback = FeedbackScorer::Feedback;
+    constexpr CandidateMasks::Block KEEP = 0;
+    constexpr CandidateMasks::Block COMPLEMENT = ~CandidateMasks::Block{0};
+
+    const int wordLength = masks ? masks->getWordLength() : 0;
+    if (static_cast<int>(guess.size()) != wordLength || feedback.size() != guess.size())
+    {
+        throw std::invalid_argument("Длина догадки не совпадает с длиной слов словаря");
+    }
+
+    std::array<MaskConstraint, MAX_CONSTRAINTS> constraints{};
+    size_t constraintsCount = 0;
+
+    // the letter is at the green positions and only there among the guessed positions
+    for (int position = 0; position < wordLength; ++position)
+    {
+        if (guess[position] >= masks->getLettersCount())
+        {
+            throw std::out_of_range("Буква догадки вне алфавита");
+        }
+        constraints[constraintsCount++] = {masks->getPositionMask(position, guess[position]).data(),
+                                           feedback[position] == Feedback::CORRECT ? KEEP : COMPLEMENT};
+    }
+
+    // a letter shown green or yellow m times is in the target at least m times,
+    // and exactly m times if one more copy of it came back absent
+    for (int position = 0; position < wordLength; ++position)
+    {
+        bool isFirstCopy = true;
+        int shownCount = 0;
+        bool hasAbsentCopy = false;
+        for (int other = 0; other < wordLength; ++other)
+        {
+            if (guess[other] != guess[position])
+            {
+                continue;
+            }
+            isFirstCopy = isFirstCopy && other >= position;
+            shownCount += feedback[other] != Feedback::ABSENT ? 1 : 0;
+            hasAbsentCopy = hasAbsentCopy || feedback[other] == Feedback::ABSENT;
+        }
+        if (!isFirstCopy)
+        {
+            continue;
+        }
+
+        if (shownCount > 0)
+        {
+            constraints[constraintsCount++] = {masks->getLetterCountMask(guess[position], shownCount).data(), KEEP};
+        }
+        if (hasAbsentCopy)
+        {
+            constraints[constraintsCount++] = {masks->getLetterCountMask(guess[position], shownCount + 1).data(), COMPLEMENT};
+        }
+    }
+
+    size_t keptBlocks = 0;
+    count = 0;
+    for (std::uint32_t block : aliveBlocks)
+    {
+        CandidateMasks::Block value = bits[block];
+        for (size_t i = 0; i < constraintsCount && value != 0; ++i)
+        {
+            value &= constraints[i].mask[block] ^ constraints[i].invert;
+        }
+        bits[block] = value;
+        if (value != 0)
+        {
+            aliveBlocks[keptBlocks++] = block;
+            count += std::popcount(value);
+        }
+    }
+    aliveBlocks.resize(keptBlocks);
+}
+
+void CandidateSet::collect(std::vector<std::uint32_t> &wordNumbers) const
+{
+    wordNumbers.clear();
+    wordNumbers.reserve(count);
+    for (std::uint32_t block : aliveBlocks)
+    {
+        for (CandidateMasks::Block value = bits[block]; value != 0; value &= value - 1)
+        {
+            wordNumbers.push_back(static_cast<std::uint32_t>((block * CandidateMasks::BLOCK_BITS) + std::countr_zero(value)));
+        }
+    }
+}
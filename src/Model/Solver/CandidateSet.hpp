@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CandidateMasks.hpp"
+#include "FeedbackScorer.hpp"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+// Answers still consistent with every feedback of the game, as a bitset.
+// A guess narrows it by ANDing the masks its feedback implies, only over the blocks that
+// still hold a candidate, so each step costs as much as the candidates left.
+class CandidateSet
+{
+private:
+    std::shared_ptr<const CandidateMasks> masks;
+    std::vector<CandidateMasks::Block> bits;
+    std::vector<std::uint32_t> aliveBlocks; // blocks of bits that are not zero
+    size_t count;
+
+public:
+    // an empty set without masks
+    CandidateSet();
+
+    // every answer of the masks' word list
+    explicit CandidateSet(std::shared_ptr<const CandidateMasks> masks);
+
+    // back to every answer of the masks' word list, keeps the buffers
+    void reset(std::shared_ptr<const CandidateMasks> masks);
+
+    const std::shared_ptr<const CandidateMasks> &getMasks() const { return masks; }
+
+    size_t getCount() const { return count; }
+
+    bool contains(size_t wordNumber) const;
+
+    // keeps the words that would give this feedback to the guess, both in letter indices
+    void narrow(std::span<const std::uint8_t> guess, std::span<const FeedbackScorer::Feedback> feedback);
+
+    // word numbers of the candidates in increasing order
+    void collect(std::vector<std::uint32_t> &wordNumbers) const;
+};
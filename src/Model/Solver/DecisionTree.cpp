@@ -0,0 +1,99 @@
+#include "DecisionTree.hpp"
+#include "../Dictionary/WordIndex.hpp"
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <string>
+
+DecisionTree::DecisionTree(const std::filesystem::path &treePath)
+    : treeFile(treePath), header(nullptr), nodes(nullptr), edges(nullptr)
+{
+    const std::byte *base = treeFile.getData();
+    const size_t fileSize = treeFile.getSize();
+    if (fileSize < sizeof(DecisionTreeHeader))
+    {
+        throw std::runtime_error("Повреждённый файл дерева подсказок!");
+    }
+
+    const auto *newHeader = reinterpret_cast<const DecisionTreeHeader *>(base);
+    if (newHeader->magic != DecisionTreeHeader::MAGIC || newHeader->version != DecisionTreeHeader::VERSION)
+    {
+        throw std::runtime_error("Неподдерживаемый формат файла дерева подсказок!");
+    }
+
+    const std::uint64_t nodesEnd = sizeof(DecisionTreeHeader) + (std::uint64_t{newHeader->nodesCount} * sizeof(DecisionTreeNode));
+    const std::uint64_t edgesEnd = nodesEnd + (std::uint64_t{newHeader->edgesCount} * sizeof(DecisionTreeEdge));
+    if (newHeader->nodesCount == 0 || edgesEnd != fileSize)
+    {
+        throw std::runtime_error("Повреждённый файл дерева подсказок!");
+    }
+
+    header = newHeader;
+    nodes = reinterpret_cast<const DecisionTreeNode *>(base + sizeof(DecisionTreeHeader));
+    edges = reinterpret_cast<const DecisionTreeEdge *>(base + nodesEnd);
+
+    for (std::uint32_t i = 0; i < header->nodesCount; ++i)
+    {
+        if (std::uint64_t{nodes[i].firstEdge} + nodes[i].edgesCount > header->edgesCount)
+        {
+            throw std::runtime_error("Повреждённый файл дерева подсказок!");
+        }
+    }
+    for (std::uint32_t i = 0; i < header->edgesCount; ++i)
+    {
+        if (edges[i].child >= header->nodesCount)
+        {
+            throw std::runtime_error("Повреждённый файл дерева подсказок!");
+        }
+    }
+}
+
+std::filesystem::path DecisionTree::getTreePath(Alphabet::Language lang, int wordLength)
+{
+    return COMPILED_DICTIONARIES_DIR "/" + Alphabet::getLanguageString(lang) + std::format("_TREE_{}L.bin", wordLength);
+}
+
+std::unique_ptr<const DecisionTree> DecisionTree::loadFor(Alphabet::Language lang, const WordIndex &index, std::uint64_t contentHash)
+{
+    const int wordLength = index.getWordLength();
+    const std::filesystem::path treePath = getTreePath(lang, wordLength);
+    std::error_code errorCode;
+    if (!std::filesystem::exists(treePath, errorCode))
+    {
+        return nullptr;
+    }
+
+    auto tree = std::make_unique<const DecisionTree>(treePath);
+    const size_t wordsCount = index.getWordLetters().size() / wordLength;
+    const bool isSameWordList = tree->getContentHash() == contentHash &&
+                                static_cast<int>(tree->header->wordLength) == wordLength &&
+                                tree->header->wordsCount == wordsCount;
+    const bool isSameAnswers = tree->header->answersCount == index.getAnswerBlocks().size() &&
+                               tree->header->answersHash == hashAnswers(index.getAnswerBlocks());
+    if (!isSameWordList || !isSameAnswers)
+    {
+        // built for another version of the word list, its word numbers mean other words,
+        // or for other answers, its strategy splits a different set
+        return nullptr;
+    }
+
+    for (std::uint32_t i = 0; i < tree->header->nodesCount; ++i)
+    {
+        if (tree->nodes[i].guessNumber >= wordsCount)
+        {
+            throw std::runtime_error("Повреждённый файл дерева подсказок!");
+        }
+    }
+    return tree;
+}
+
+const DecisionTreeNode *DecisionTree::getChild(const DecisionTreeNode &node, std::uint32_t patternCode) const
+{
+    const std::span<const DecisionTreeEdge> nodeEdges(edges + node.firstEdge, node.edgesCount);
+    const auto edge = std::ranges::lower_bound(nodeEdges, patternCode, {}, &DecisionTreeEdge::patternCode);
+    if (edge == nodeEdges.end() || edge->patternCode != patternCode)
+    {
+        return nullptr;
+    }
+    return &nodes[edge->child];
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../Dictionary/Alphabet.hpp"
+#include "../Dictionary/CompiledDictionaryFormat.hpp"
+#include "../Dictionary/MappedFile.hpp"
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+
+class WordIndex;
+
+// Binary strategy tree produced by the DecisionTreeBuilder tool:
+//
+//   DecisionTreeHeader
+//   DecisionTreeNode nodes[nodesCount] - node 0 is the opener, children follow their parents
+//   DecisionTreeEdge edges[edgesCount] - per node sorted by pattern code
+//
+// Guesses are word numbers of the word list the tree was built from (blocks of
+// WordIndex::getWordLetters()), the header keeps its hash (see PatternMatrix::hashContent) and
+// the hash of the answers the tree splits (see DecisionTree::hashAnswers).
+// Integers are stored in native byte order.
+struct DecisionTreeHeader
+{
+    static constexpr std::array<char, 8> MAGIC = {'W', 'R', 'D', 'L', 'T', 'R', 'E', 'E'};
+    static constexpr std::uint32_t VERSION = 2;
+
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t wordLength;
+    std::uint32_t nodesCount;
+    std::uint32_t edgesCount;
+    std::uint32_t wordsCount;   // blocks of the word list, every guess number is below it
+    std::uint32_t answersCount; // answer blocks the tree was built for
+    std::uint64_t contentHash;
+    std::uint64_t answersHash;
+};
+
+struct DecisionTreeNode
+{
+    std::uint32_t guessNumber;
+    std::uint32_t firstEdge;
+    std::uint32_t edgesCount;
+    float expectedRemaining; // candidates left after the guess, averaged over the node's answers
+};
+
+struct DecisionTreeEdge
+{
+    std::uint32_t patternCode;
+    std::uint32_t child;
+};
+
+// Memory-mapped strategy tree: the hint after a sequence of feedback codes is one edge
+// lookup per guess played.
+class DecisionTree
+{
+private:
+    MappedFile treeFile;
+    const DecisionTreeHeader *header;
+    const DecisionTreeNode *nodes;
+    const DecisionTreeEdge *edges;
+
+public:
+    explicit DecisionTree(const std::filesystem::path &treePath);
+
+    static std::filesystem::path getTreePath(Alphabet::Language lang, int wordLength);
+
+    // answers a tree was built for, a changed answers file gives a new hash over the same word list
+    static std::uint64_t hashAnswers(std::span<const std::uint32_t> answerBlocks)
+    {
+        const std::string_view bytes(reinterpret_cast<const char *>(answerBlocks.data()), answerBlocks.size_bytes());
+        return CompiledDictionaryFormat::hash(bytes);
+    }
+
+    // tree of the language and length if it exists and was built from this word list (contentHash,
+    // see PatternMatrix::hashContent) and its answers; throws if the tree names words the list lacks
+    static std::unique_ptr<const DecisionTree> loadFor(Alphabet::Language lang, const WordIndex &index, std::uint64_t contentHash);
+
+    std::uint64_t getContentHash() const { return header->contentHash; }
+
+    const DecisionTreeNode &getRoot() const { return nodes[0]; }
+
+    // node after the guess of node gave this feedback, nullptr if the answer was found or is not in the tree
+    const DecisionTreeNode *getChild(const DecisionTreeNode &node, std::uint32_t patternCode) const;
+};
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+// Wordle feedback of one guess against one target, computed on letter indices (see LetterCodec)
+// in fixed-size stack arrays, so scoring never touches the heap.
+// Repeated letters follow the game rules: exact matches are taken first, then the remaining
+// target letters are handed out left to right as "present".
+class FeedbackScorer
+{
+public:
+    enum class Feedback : std::uint8_t
+    {
+        ABSENT = 0,
+        PRESENT = 1,
+        CORRECT = 2
+    };
+
+    // feedback of letter i is the i-th base-3 digit, least significant first
+    using PatternCode = std::uint32_t;
+
+    static constexpr int MAX_WORD_LENGTH = 16; // 3^16 still fits PatternCode
+
+    // lengths with a scorer compiled for them, see getScoreFunction
+    static constexpr int MIN_FIXED_LENGTH = 4;
+    static constexpr int MAX_FIXED_LENGTH = 12;
+
+    using ScoreFunction = PatternCode (*)(const std::uint8_t *guess, const std::uint8_t *target, Feedback *feedback);
+
+    FeedbackScorer() = delete;
+
+    static constexpr PatternCode digitWeight(int position)
+    {
+        PatternCode weight = 1;
+        for (int i = 0; i < position; ++i)
+        {
+            weight *= 3;
+        }
+        return weight;
+    }
+
+    // code of a fully guessed word of the given length
+    static constexpr PatternCode allCorrect(int wordLength)
+    {
+        return digitWeight(wordLength) - 1;
+    }
+
+    // guess and target must have the same length, up to MAX_WORD_LENGTH
+    static constexpr PatternCode score(std::span<const std::uint8_t> guess, std::span<const std::uint8_t> target,
+                                       std::span<Feedback> feedback)
+    {
+        std::array<std::uint8_t, 256> unmatchedCounts{};
+
+        for (size_t i = 0; i < guess.size(); ++i)
+        {
+            if (guess[i] == target[i])
+            {
+                feedback[i] = Feedback::CORRECT;
+            }
+            else
+            {
+                feedback[i] = Feedback::ABSENT;
+                unmatchedCounts[target[i]]++;
+            }
+        }
+
+        PatternCode code = 0;
+        PatternCode weight = 1;
+        for (size_t i = 0; i < guess.size(); ++i, weight *= 3)
+        {
+            if (feedback[i] == Feedback::ABSENT && unmatchedCounts[guess[i]] > 0)
+            {
+                feedback[i] = Feedback::PRESENT;
+                unmatchedCounts[guess[i]]--;
+            }
+            code += static_cast<PatternCode>(feedback[i]) * weight;
+        }
+        return code;
+    }
+
+    static constexpr PatternCode score(std::span<const std::uint8_t> guess, std::span<const std::uint8_t> target)
+    {
+        std::array<Feedback, MAX_WORD_LENGTH> feedback{};
+        return score(guess, target, std::span(feedback).first(guess.size()));
+    }
+
+    // score() for words of LENGTH letters: the loops have fixed trip counts and unroll, and only
+    // the counters of the letters of both words are cleared instead of the whole table
+    template <int LENGTH>
+    static constexpr PatternCode scoreFixed(const std::uint8_t *guess, const std::uint8_t *target, Feedback *feedback)
+    {
+        std::array<std::uint8_t, 256> unmatchedCounts;
+        for (int i = 0; i < LENGTH; ++i)
+        {
+            unmatchedCounts[guess[i]] = 0;
+            unmatchedCounts[target[i]] = 0;
+        }
+
+        for (int i = 0; i < LENGTH; ++i)
+        {
+            if (guess[i] == target[i])
+            {
+                feedback[i] = Feedback::CORRECT;
+            }
+            else
+            {
+                feedback[i] = Feedback::ABSENT;
+                unmatchedCounts[target[i]]++;
+            }
+        }
+
+        PatternCode code = 0;
+        PatternCode weight = 1;
+        for (int i = 0; i < LENGTH; ++i, weight *= 3)
+        {
+            if (feedback[i] == Feedback::ABSENT && unmatchedCounts[guess[i]] > 0)
+            {
+                feedback[i] = Feedback::PRESENT;
+                unmatchedCounts[guess[i]]--;
+            }
+            code += static_cast<PatternCode>(feedback[i]) * weight;
+        }
+        return code;
+    }
+
+    static constexpr bool hasFixedLength(int wordLength)
+    {
+        return wordLength >= MIN_FIXED_LENGTH && wordLength <= MAX_FIXED_LENGTH;
+    }
+
+    // scoreFixed instantiated for wordLength, nullptr if hasFixedLength(wordLength) is false
+    static constexpr ScoreFunction getScoreFunction(int wordLength)
+    {
+        switch (wordLength)
+        {
+        case 4:
+            return &scoreFixed<4>;
+        case 5:
+            return &scoreFixed<5>;
+        case 6:
+            return &scoreFixed<6>;
+        case 7:
+            return &scoreFixed<7>;
+        case 8:
+            return &scoreFixed<8>;
+        case 9:
+            return &scoreFixed<9>;
+        case 10:
+            return &scoreFixed<10>;
+        case 11:
+            return &scoreFixed<11>;
+        case 12:
+            return &scoreFixed<12>;
+        default:
+            return nullptr;
+        }
+    }
+
+    static constexpr void decode(PatternCode code, std::span<Feedback> feedback)
+    {
+        for (Feedback &letterFeedback : feedback)
+        {
+            letterFeedback = static_cast<Feedback>(code % 3);
+            code /= 3;
+        }
+    }
+
+};
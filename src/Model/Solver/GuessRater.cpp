@@ -0,0 +1,48 @@
+#include "GuessRater.hpp"
+#include "PatternMatrix.hpp"
+#include <cmath>
+#include <stdexcept>
+
+GuessRater::GuessRater(const PatternMatrix &_patternMatrix, std::span<const std::uint32_t> _candidates)
+    : patternMatrix(_patternMatrix),
+      candidates(_candidates),
+      bucketWeights(_candidates.size() + 1, 0.0),
+      isCandidate(_patternMatrix.getWordsCount(), false)
+{
+    if (candidates.empty())
+    {
+        throw std::invalid_argument("Нет слов, подходящих под ответы");
+    }
+
+    for (size_t size = 2; size < bucketWeights.size(); ++size)
+    {
+        bucketWeights[size] = static_cast<double>(size) * std::log2(static_cast<double>(size));
+    }
+    for (std::uint32_t candidate : candidates)
+    {
+        isCandidate[candidate] = true;
+    }
+}
+
+HintEngine::Ranking GuessRater::rate(size_t guessNumber, BucketSizes &bucketSizes) const
+{
+    const auto patterns = patternMatrix.getRow(guessNumber);
+    bucketSizes.fill(0);
+    for (std::uint32_t candidate : candidates)
+    {
+        bucketSizes[patterns[candidate]]++;
+    }
+
+    // entropy = log2(n) - sum(c * log2(c)) / n over the pattern buckets of sizes c
+    double weightSum = 0.0;
+    double squaredSum = 0.0;
+    for (std::uint32_t bucketSize : bucketSizes)
+    {
+        weightSum += bucketWeights[bucketSize];
+        squaredSum += static_cast<double>(bucketSize) * bucketSize;
+    }
+
+    const auto candidatesCount = static_cast<double>(candidates.size());
+    return {guessNumber, std::log2(candidatesCount) - (weightSum / candidatesCount), squaredSum / candidatesCount,
+            isCandidate[guessNumber]};
+}
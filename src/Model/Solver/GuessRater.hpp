@@ -0,0 +1,34 @@
+#pragma once
+
+#include "BatchScorer.hpp"
+#include "FeedbackScorer.hpp"
+#include "HintEngine.hpp"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class PatternMatrix;
+
+// Rates guesses against one set of candidates by the entropy of their pattern split.
+// Shared by the exhaustive ranking and the anytime search; rating is const, so one rater
+// serves many threads as long as each brings its own bucket buffer.
+class GuessRater
+{
+public:
+    static constexpr size_t PATTERNS_COUNT = FeedbackScorer::allCorrect(BatchScorer::MAX_WORD_LENGTH) + 1;
+
+    using BucketSizes = std::array<std::uint32_t, PATTERNS_COUNT>;
+
+private:
+    const PatternMatrix &patternMatrix;
+    std::span<const std::uint32_t> candidates;
+    std::vector<double> bucketWeights; // c * log2(c) for every bucket size c
+    std::vector<bool> isCandidate;
+
+public:
+    // both must outlive the rater
+    GuessRater(const PatternMatrix &patternMatrix, std::span<const std::uint32_t> candidates);
+
+    HintEngine::Ranking rate(size_t guessNumber, BucketSizes &bucketSizes) const;
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "FeedbackScorer.hpp"
+#include <array>
+#include <cstdint>
+#include <span>
+
+// One guess scored against many targets, for words of any length up to MAX_WORD_LENGTH.
+// The positions of every letter of the guess are found once; a target then costs a few mask
+// operations per letter, without a counting table to clear.
+// Every non-green target letter takes the leftmost non-green guess position of the same letter
+// that is still free, which is the left-to-right assignment of FeedbackScorer. A guess without
+// repeated letters skips that hand-out: a position is yellow if any non-green target letter
+// matches it, so the target letters are combined independently of each other.
+class GuessScorer
+{
+public:
+    static constexpr int MAX_WORD_LENGTH = 16;
+
+private:
+    using PositionMask = std::uint32_t; // bit p is position p
+
+    static constexpr int DIGITS_PER_CHUNK = 6;
+    static constexpr PositionMask CHUNK_MASK = (1U << DIGITS_PER_CHUNK) - 1;
+
+    // base-3 number with digit 1 at every set bit of a chunk
+    static constexpr std::array<FeedbackScorer::PatternCode, 1U << DIGITS_PER_CHUNK> CHUNK_CODES = []()
+    {
+        std::array<FeedbackScorer::PatternCode, 1U << DIGITS_PER_CHUNK> codes{};
+        for (PositionMask mask = 0; mask < codes.size(); ++mask)
+        {
+            for (int position = 0; position < DIGITS_PER_CHUNK; ++position)
+            {
+                codes[mask] += ((mask >> position) & 1U) * FeedbackScorer::digitWeight(position);
+            }
+        }
+        return codes;
+    }();
+
+    std::array<PositionMask, 256> letterPositions{}; // positions of every letter in the guess
+    std::array<std::uint8_t, MAX_WORD_LENGTH> guess{};
+    int wordLength;
+    bool hasRepeatedLetters = false;
+
+    static constexpr FeedbackScorer::PatternCode toCode(PositionMask mask)
+    {
+        return CHUNK_CODES[mask & CHUNK_MASK] +
+               (CHUNK_CODES[(mask >> DIGITS_PER_CHUNK) & CHUNK_MASK] * FeedbackScorer::digitWeight(DIGITS_PER_CHUNK)) +
+               (CHUNK_CODES[(mask >> (2 * DIGITS_PER_CHUNK)) & CHUNK_MASK] * FeedbackScorer::digitWeight(2 * DIGITS_PER_CHUNK));
+    }
+
+public:
+    explicit constexpr GuessScorer(std::span<const std::uint8_t> _guess) : wordLength(static_cast<int>(_guess.size()))
+    {
+        for (int position = 0; position < wordLength; ++position)
+        {
+            guess[position] = _guess[position];
+            hasRepeatedLetters = hasRepeatedLetters || letterPositions[_guess[position]] != 0;
+            letterPositions[_guess[position]] |= PositionMask{1} << position;
+        }
+    }
+
+    // pattern code of the guess against a target of the same length
+    constexpr FeedbackScorer::PatternCode score(const std::uint8_t *target) const
+    {
+        PositionMask green = 0;
+        for (int position = 0; position < wordLength; ++position)
+        {
+            green |= static_cast<PositionMask>(guess[position] == target[position]) << position;
+        }
+
+        PositionMask yellow = 0;
+        if (!hasRepeatedLetters)
+        {
+            for (int position = 0; position < wordLength; ++position)
+            {
+                const PositionMask isCounted = ((green >> position) & 1U) - 1U; // all ones if the target letter is not green
+                yellow |= letterPositions[target[position]] & isCounted;
+            }
+            return (2 * toCode(green)) + toCode(yellow & ~green);
+        }
+
+        for (int position = 0; position < wordLength; ++position)
+        {
+            const PositionMask free = letterPositions[target[position]] & ~green & ~yellow;
+            const PositionMask isCounted = ((green >> position) & 1U) - 1U;
+            yellow |= free & (0U - free) & isCounted;
+        }
+        return (2 * toCode(green)) + toCode(yellow);
+    }
+};
@@ -0,0 +1,113 @@
+#include "HintEngine.hpp"
+#include "../Dictionary/WordIndex.hpp"
+#include "DecisionTree.hpp"
+#include "GuessRater.hpp"
+#include "PatternMatrix.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+
+namespace
+{
+constexpr size_t GUESSES_PER_TASK = 64;
+} // namespace
+
+bool HintEngine::isBetter(const Ranking &first, const Ranking &second)
+{
+    if (first.entropyBits != second.entropyBits)
+    {
+        return first.entropyBits > second.entropyBits;
+    }
+    if (first.isCandidate != second.isCandidate)
+    {
+        return first.isCandidate;
+    }
+    return first.guessNumber < second.guessNumber;
+}
+
+HintEngine::HintEngine(std::shared_ptr<const WordIndex> _wordIndex, Alphabet::Language lang)
+    : wordIndex(std::move(_wordIndex)),
+      patternMatrix(PatternMatrix::loadOrBuild(*wordIndex, lang)),
+      initialCandidates(wordIndex->getAnswerBlocks().begin(), wordIndex->getAnswerBlocks().end())
+{
+    // ranked once here, so the opening hint is a lookup even on the full dictionary
+    openingRanking = rankGuesses(initialCandidates);
+
+    try
+    {
+        decisionTree = DecisionTree::loadFor(lang, *wordIndex, patternMatrix->getContentHash());
+    }
+    catch (const std::exception &)
+    {
+        // a damaged tree file, hints are ranked on demand
+    }
+}
+
+HintEngine::~HintEngine() = default;
+
+bool HintEngine::canHint(const WordIndex &index)
+{
+    const int wordLength = index.getWordLength();
+    return !index.getAnswerBlocks().empty() &&
+           PatternMatrix::canTabulate(index.getWordLetters().size() / wordLength, wordLength);
+}
+
+size_t HintEngine::getGuessesCount() const
+{
+    return patternMatrix->getWordsCount();
+}
+
+HintEngine::Ranking HintEngine::rankGuesses(std::span<const std::uint32_t> candidates) const
+{
+    const GuessRater rater(*patternMatrix, candidates);
+    const size_t guessesCount = patternMatrix->getWordsCount();
+
+    std::atomic<size_t> nextTask = 0;
+    const size_t tasksCount = (guessesCount + GUESSES_PER_TASK - 1) / GUESSES_PER_TASK;
+    const size_t workersCount = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), tasksCount);
+    std::vector<Ranking> workerBest(workersCount);
+
+    auto rankTasks = [&](size_t workerNumber)
+    {
+        GuessRater::BucketSizes bucketSizes{};
+        Ranking best;
+        best.entropyBits = -1.0;
+
+        for (size_t task = nextTask.fetch_add(1); task < tasksCount; task = nextTask.fetch_add(1))
+        {
+            const size_t lastGuess = std::min((task + 1) * GUESSES_PER_TASK, guessesCount);
+            for (size_t guessNumber = task * GUESSES_PER_TASK; guessNumber < lastGuess; ++guessNumber)
+            {
+                const Ranking ranking = rater.rate(guessNumber, bucketSizes);
+                if (isBetter(ranking, best))
+                {
+                    best = ranking;
+                }
+            }
+        }
+        workerBest[workerNumber] = best;
+    };
+
+    {
+        std::vector<std::jthread> workers;
+        for (size_t workerNumber = 1; workerNumber < workersCount; ++workerNumber)
+        {
+            workers.emplace_back(rankTasks, workerNumber);
+        }
+        rankTasks(0);
+    }
+
+    return std::ranges::min(workerBest, isBetter);
+}
+
+std::string_view HintEngine::getWord(size_t wordNumber) const
+{
+    return wordIndex->getWord(wordIndex->getLettersWordNumber(wordNumber));
+}
+
+std::span<const std::uint8_t> HintEngine::getWordLetters(size_t wordNumber) const
+{
+    const auto wordLength = static_cast<size_t>(wordIndex->getWordLength());
+    return wordIndex->getWordLetters().subspan(wordNumber * wordLength, wordLength);
+}
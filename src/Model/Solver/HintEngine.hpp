@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../Dictionary/Alphabet.hpp"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+class DecisionTree;
+class PatternMatrix;
+class WordIndex;
+
+// Ranks every dictionary word as a guess by the information its feedback gives about the
+// remaining candidates: a guess splits the candidates by pattern code, the best one has the
+// highest entropy of that split. Words are numbered as the blocks of WordIndex::getWordLetters().
+class HintEngine
+{
+public:
+    struct Ranking
+    {
+        size_t guessNumber = 0;
+        double entropyBits = 0.0;
+        double expectedRemaining = 0.0; // candidates left after the guess, averaged over the targets
+        bool isCandidate = false;       // the guess may itself be the answer
+    };
+
+    // higher entropy wins, then a guess that may be the answer, then the lower number
+    static bool isBetter(const Ranking &first, const Ranking &second);
+
+private:
+    std::shared_ptr<const WordIndex> wordIndex;
+    std::shared_ptr<const PatternMatrix> patternMatrix;
+    std::vector<std::uint32_t> initialCandidates;
+    Ranking openingRanking; // the first guess of every game ranks the same candidates
+    std::unique_ptr<const DecisionTree> decisionTree;
+
+public:
+    // loads or builds the pattern matrix of the snapshot, throws if it cannot be tabulated;
+    // a prebuilt decision tree is picked up if it matches the word list
+    HintEngine(std::shared_ptr<const WordIndex> wordIndex, Alphabet::Language lang);
+
+    ~HintEngine();
+
+    static bool canHint(const WordIndex &index);
+
+    const std::shared_ptr<const WordIndex> &getWordIndex() const { return wordIndex; }
+
+    const PatternMatrix &getPatternMatrix() const { return *patternMatrix; }
+
+    size_t getGuessesCount() const;
+
+    // every answer, before any guess
+    std::span<const std::uint32_t> getInitialCandidates() const { return initialCandidates; }
+
+    // best guess for the candidates, computed on all hardware threads;
+    // ties go to a guess that can itself be the target
+    Ranking rankGuesses(std::span<const std::uint32_t> candidates) const;
+
+    const Ranking &getOpeningRanking() const { return openingRanking; }
+
+    // nullptr if there is no tree for this word list
+    const DecisionTree *getDecisionTree() const { return decisionTree.get(); }
+
+    std::string_view getWord(size_t wordNumber) const;
+
+    // letter indices of the word, see LetterCodec
+    std::span<const std::uint8_t> getWordLetters(size_t wordNumber) const;
+};
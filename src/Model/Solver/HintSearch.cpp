@@ -0,0 +1,151 @@
+#include "HintSearch.hpp"
+#include "GuessRater.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <utility>
+
+namespace
+{
+// small enough that cancelling or the deadline is noticed within a fraction of a frame
+constexpr size_t GUESSES_PER_TASK = 64;
+} // namespace
+
+HintSearch::HintSearch(EngineSource engineSource, std::vector<std::uint32_t> candidates,
+                       std::chrono::milliseconds timeBudget, GuessFilter guessFilter)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeBudget;
+    searchThread = std::jthread(
+        [this, deadline, engineSource = std::move(engineSource), guessFilter = std::move(guessFilter),
+         candidates = std::move(candidates)](std::stop_token stopToken)
+        {
+            run(stopToken, engineSource, guessFilter, candidates, deadline);
+        });
+}
+
+HintSearch::Progress HintSearch::getProgress() const
+{
+    std::scoped_lock lock(progressMutex);
+    return progress;
+}
+
+bool HintSearch::isFinished() const
+{
+    std::scoped_lock lock(progressMutex);
+    return progress.isFinished;
+}
+
+void HintSearch::cancel()
+{
+    searchThread.request_stop();
+}
+
+void HintSearch::publish(const HintEngine::Ranking &ranking, size_t ratedCount)
+{
+    std::scoped_lock lock(progressMutex);
+    if (!progress.best || HintEngine::isBetter(ranking, *progress.best))
+    {
+        progress.best = ranking;
+    }
+    progress.ratedCount += ratedCount;
+}
+
+void HintSearch::run(std::stop_token stopToken, const EngineSource &engineSource, const GuessFilter &guessFilter,
+                     const std::vector<std::uint32_t> &candidates, std::chrono::steady_clock::time_point deadline)
+{
+    try
+    {
+        const std::shared_ptr<const HintEngine> engine = engineSource();
+        if (engine && !candidates.empty() && !stopToken.stop_requested())
+        {
+            const size_t wordsCount = engine->getGuessesCount();
+            auto isAllowed = [&](size_t guessNumber)
+            {
+                return !guessFilter || guessFilter(engine->getWordLetters(guessNumber));
+            };
+
+            // narrowing only removes words, so the full answer list means no guess was played yet
+            // and the filter has nothing to forbid
+            if (candidates.size() == engine->getInitialCandidates().size())
+            {
+                {
+                    std::scoped_lock lock(progressMutex);
+                    progress.engine = engine;
+                    progress.guessesCount = wordsCount;
+                }
+                publish(engine->getOpeningRanking(), wordsCount);
+            }
+            else
+            {
+                // candidates go first, they are the likely hints and win the ties
+                std::vector<std::uint32_t> guessOrder;
+                guessOrder.reserve(wordsCount);
+                std::ranges::copy_if(candidates, std::back_inserter(guessOrder), isAllowed);
+                for (size_t guessNumber = 0, candidate = 0; guessNumber < wordsCount; ++guessNumber)
+                {
+                    if (candidate < candidates.size() && candidates[candidate] == guessNumber)
+                    {
+                        ++candidate;
+                        continue;
+                    }
+                    if (isAllowed(guessNumber))
+                    {
+                        guessOrder.push_back(static_cast<std::uint32_t>(guessNumber));
+                    }
+                }
+
+                const size_t guessesCount = guessOrder.size();
+                {
+                    std::scoped_lock lock(progressMutex);
+                    progress.engine = engine;
+                    progress.guessesCount = guessesCount;
+                }
+
+                const GuessRater rater(engine->getPatternMatrix(), candidates);
+                std::atomic<size_t> nextTask = 0;
+                const size_t tasksCount = (guessesCount + GUESSES_PER_TASK - 1) / GUESSES_PER_TASK;
+                // one hardware thread stays with the render loop
+                const size_t workersCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, tasksCount + 1) - 1;
+
+                auto rateTasks = [&]()
+                {
+                    GuessRater::BucketSizes bucketSizes{};
+                    for (size_t task = nextTask.fetch_add(1); task < tasksCount; task = nextTask.fetch_add(1))
+                    {
+                        if (stopToken.stop_requested() || (task != 0 && std::chrono::steady_clock::now() >= deadline))
+                        {
+                            break;
+                        }
+
+                        const size_t lastGuess = std::min((task + 1) * GUESSES_PER_TASK, guessesCount);
+                        HintEngine::Ranking best = rater.rate(guessOrder[task * GUESSES_PER_TASK], bucketSizes);
+                        for (size_t orderNumber = (task * GUESSES_PER_TASK) + 1; orderNumber < lastGuess; ++orderNumber)
+                        {
+                            const HintEngine::Ranking ranking = rater.rate(guessOrder[orderNumber], bucketSizes);
+                            if (HintEngine::isBetter(ranking, best))
+                            {
+                                best = ranking;
+                            }
+                        }
+                        publish(best, lastGuess - (task * GUESSES_PER_TASK));
+                    }
+                };
+
+                std::vector<std::jthread> workers;
+                for (size_t workerNumber = 1; workerNumber < workersCount; ++workerNumber)
+                {
+                    workers.emplace_back(rateTasks);
+                }
+                rateTasks();
+            }
+        }
+    }
+    catch (const std::exception &)
+    {
+        // no hint for this state, e.g. the pattern matrix could not be built
+    }
+
+    std::scoped_lock lock(progressMutex);
+    progress.isFinished = true;
+}
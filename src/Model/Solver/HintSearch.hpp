@@ -0,0 +1,67 @@
+#pragma once
+
+#include "HintEngine.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+// Anytime hint search: rates guesses on background threads and publishes the best one so far
+// after every task, so a hint can be shown at once and refines until every guess is rated,
+// the time budget runs out or the search is cancelled. Candidates are rated before the other
+// words, the first task always finishes, so a search that started gives a hint.
+class HintSearch
+{
+public:
+    // called on the search thread, may build the pattern matrix; nullptr means no hints
+    using EngineSource = std::function<std::shared_ptr<const HintEngine>()>;
+
+    // letters of a word as HintEngine::getWordLetters() gives them, true if it may be guessed
+    using GuessFilter = std::function<bool(std::span<const std::uint8_t>)>;
+
+    struct Progress
+    {
+        std::shared_ptr<const HintEngine> engine; // nullptr until the source returned it
+        std::optional<HintEngine::Ranking> best;
+        size_t ratedCount = 0;
+        size_t guessesCount = 0; // that pass the filter
+        bool isFinished = false; // no more refinements will come
+    };
+
+private:
+    mutable std::mutex progressMutex;
+    Progress progress;
+    std::jthread searchThread; // declared last, stops and joins before the state above goes away
+
+    void run(std::stop_token stopToken, const EngineSource &engineSource, const GuessFilter &guessFilter,
+             const std::vector<std::uint32_t> &candidates, std::chrono::steady_clock::time_point deadline);
+
+    void publish(const HintEngine::Ranking &ranking, size_t ratedCount);
+
+public:
+    // candidates are word numbers of the engine's word list in increasing order, the budget
+    // counts from here and includes preparing the engine; only the guesses the filter accepts are
+    // rated, an empty filter accepts all
+    HintSearch(EngineSource engineSource, std::vector<std::uint32_t> candidates, std::chrono::milliseconds timeBudget,
+               GuessFilter guessFilter = nullptr);
+
+    // stops and waits for the current task of every thread
+    ~HintSearch() = default;
+
+    [[nodiscard]] Progress getProgress() const;
+
+    bool isFinished() const;
+
+    // asks the threads to stop after their current task, does not wait for them
+    void cancel();
+
+    HintSearch(const HintSearch &other) = delete;
+
+    HintSearch &operator=(const HintSearch &other) = delete;
+};
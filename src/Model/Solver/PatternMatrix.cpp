@@ -0,0 +1,181 @@
+#include "PatternMatrix.hpp"
+#include "../Dictionary/CompiledDictionaryFormat.hpp"
+#include "../Dictionary/WordIndex.hpp"
+#include "BatchScorer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+namespace
+{
+// a tile keeps TILE_TARGETS columns of letters in L2 while TILE_GUESSES rows are scored against them
+constexpr size_t TILE_GUESSES = 64;
+constexpr size_t TILE_TARGETS = 8192;
+
+std::string getCachePrefix(Alphabet::Language lang, int wordLength)
+{
+    return Alphabet::getLanguageString(lang) + std::format("_PATTERNS_{}L_", wordLength);
+}
+} // namespace
+
+PatternMatrix::PatternMatrix(const BatchScorer &scorer, std::uint64_t _contentHash)
+    : wordLength(scorer.getWordLength()), wordsCount(scorer.getWordsCount()), contentHash(_contentHash),
+      storage(wordsCount * wordsCount), patterns(storage.data())
+{
+    const size_t guessTiles = (wordsCount + TILE_GUESSES - 1) / TILE_GUESSES;
+    const size_t targetTiles = (wordsCount + TILE_TARGETS - 1) / TILE_TARGETS;
+    const size_t tilesCount = guessTiles * targetTiles;
+    std::atomic<size_t> nextTile = 0;
+
+    auto scoreTiles = [&]()
+    {
+        std::array<std::uint8_t, BatchScorer::MAX_WORD_LENGTH> guess{};
+        for (size_t tile = nextTile.fetch_add(1); tile < tilesCount; tile = nextTile.fetch_add(1))
+        {
+            const size_t firstGuess = (tile / targetTiles) * TILE_GUESSES;
+            const size_t firstTarget = (tile % targetTiles) * TILE_TARGETS;
+            const size_t lastGuess = std::min(firstGuess + TILE_GUESSES, wordsCount);
+            const size_t targetsCount = std::min(TILE_TARGETS, wordsCount - firstTarget);
+
+            for (size_t guessNumber = firstGuess; guessNumber < lastGuess; ++guessNumber)
+            {
+                scorer.getWord(guessNumber, guess);
+                scorer.scoreRange(std::span<const std::uint8_t>(guess).first(wordLength), firstTarget,
+                                  std::span(storage).subspan((guessNumber * wordsCount) + firstTarget, targetsCount));
+            }
+        }
+    };
+
+    const size_t workersCount = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), tilesCount);
+    {
+        std::vector<std::jthread> workers;
+        for (size_t i = 1; i < workersCount; ++i)
+        {
+            workers.emplace_back(scoreTiles);
+        }
+        scoreTiles();
+    }
+}
+
+PatternMatrix::PatternMatrix(std::unique_ptr<MappedFile> mappedCacheFile) : cacheFile(std::move(mappedCacheFile))
+{
+    const auto *header = reinterpret_cast<const PatternMatrixHeader *>(cacheFile->getData());
+    wordLength = static_cast<int>(header->wordLength);
+    wordsCount = header->wordsCount;
+    contentHash = header->contentHash;
+    patterns = reinterpret_cast<const std::uint8_t *>(cacheFile->getData() + PATTERNS_POSITION);
+}
+
+bool PatternMatrix::canTabulate(size_t wordsCount, int wordLength)
+{
+    return BatchScorer::isSupportedLength(wordLength) && wordsCount > 0 &&
+           wordsCount <= MAX_MATRIX_SIZE / wordsCount;
+}
+
+std::uint64_t PatternMatrix::hashContent(std::span<const std::uint8_t> wordLetters, int wordLength)
+{
+    const std::string_view letters(reinterpret_cast<const char *>(wordLetters.data()), wordLetters.size());
+    return CompiledDictionaryFormat::hash(letters) ^ static_cast<std::uint64_t>(wordLength);
+}
+
+std::filesystem::path PatternMatrix::getCachePath(Alphabet::Language lang, int wordLength, std::uint64_t contentHash)
+{
+    return CACHE_DIR "/" + getCachePrefix(lang, wordLength) + std::format("{:016x}.bin", contentHash);
+}
+
+std::shared_ptr<const PatternMatrix> PatternMatrix::loadOrBuild(const WordIndex &index, Alphabet::Language lang)
+{
+    const int wordLength = index.getWordLength();
+    const std::uint64_t contentHash = hashContent(index.getWordLetters(), wordLength);
+    const std::filesystem::path cachePath = getCachePath(lang, wordLength, contentHash);
+    const size_t wordsCount = index.getWordLetters().size() / wordLength;
+
+    if (!canTabulate(wordsCount, wordLength))
+    {
+        throw std::invalid_argument("Словарь слишком велик для таблицы подсказок");
+    }
+
+    std::error_code errorCode;
+    if (std::filesystem::exists(cachePath, errorCode))
+    {
+        try
+        {
+            auto mappedCacheFile = std::make_unique<MappedFile>(cachePath);
+            const auto *header = reinterpret_cast<const PatternMatrixHeader *>(mappedCacheFile->getData());
+            const bool isValid = mappedCacheFile->getSize() == PATTERNS_POSITION + (wordsCount * wordsCount) &&
+                                 header->magic == PatternMatrixHeader::MAGIC &&
+                                 header->version == PatternMatrixHeader::VERSION &&
+                                 static_cast<int>(header->wordLength) == wordLength &&
+                                 header->wordsCount == wordsCount && header->contentHash == contentHash;
+            if (isValid)
+            {
+                return std::shared_ptr<const PatternMatrix>(new PatternMatrix(std::move(mappedCacheFile)));
+            }
+        }
+        catch (const std::exception &)
+        {
+            // unreadable cache, rebuilt below
+        }
+    }
+
+    // the word list changed or the cache was never written
+    invalidate(lang, wordLength);
+    auto matrix = std::make_shared<const PatternMatrix>(BatchScorer(index.getWordLetters(), wordLength), contentHash);
+    try
+    {
+        matrix->save(cachePath);
+    }
+    catch (const std::exception &)
+    {
+        // the cache is an optimization, the matrix in memory is still valid
+    }
+    return matrix;
+}
+
+void PatternMatrix::invalidate(Alphabet::Language lang, int wordLength)
+{
+    const std::string prefix = getCachePrefix(lang, wordLength);
+    std::error_code errorCode;
+    for (const auto &entry : std::filesystem::directory_iterator(CACHE_DIR, errorCode))
+    {
+        if (entry.path().filename().string().starts_with(prefix))
+        {
+            std::filesystem::remove(entry.path(), errorCode);
+        }
+    }
+}
+
+void PatternMatrix::save(const std::filesystem::path &cachePath) const
+{
+    std::filesystem::create_directories(cachePath.parent_path());
+
+    PatternMatrixHeader header{};
+    header.magic = PatternMatrixHeader::MAGIC;
+    header.version = PatternMatrixHeader::VERSION;
+    header.wordLength = static_cast<std::uint32_t>(wordLength);
+    header.wordsCount = wordsCount;
+    header.contentHash = contentHash;
+
+    std::array<char, PATTERNS_POSITION> headerBytes{};
+    std::memcpy(headerBytes.data(), &header, sizeof(header));
+
+    std::filesystem::path temporaryPath = cachePath;
+    temporaryPath += ".tmp";
+    {
+        std::ofstream cacheOutput(temporaryPath, std::ios::binary | std::ios::trunc);
+        cacheOutput.write(headerBytes.data(), headerBytes.size());
+        cacheOutput.write(reinterpret_cast<const char *>(patterns), static_cast<std::streamsize>(wordsCount * wordsCount));
+        if (!cacheOutput)
+        {
+            throw std::runtime_error("Не удалось записать кэш подсказок " + temporaryPath.string());
+        }
+    }
+    std::filesystem::rename(temporaryPath, cachePath);
+}
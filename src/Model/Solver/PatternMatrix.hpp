@@ -0,0 +1,100 @@
+#pragma once
+
+#include "../Dictionary/Alphabet.hpp"
+#include "../Dictionary/MappedFile.hpp"
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+class BatchScorer;
+class WordIndex;
+
+// Cache file layout:
+//
+//   PatternMatrixHeader
+//   uint8_t patterns[wordsCount * wordsCount] - row per guess, column per target, from offset 32
+//
+// Integers are stored in native byte order.
+struct PatternMatrixHeader
+{
+    static constexpr std::array<char, 8> MAGIC = {'W', 'R', 'D', 'L', 'P', 'T', 'R', 'N'};
+    static constexpr std::uint32_t VERSION = 1;
+
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t wordLength;
+    std::uint64_t wordsCount;
+    std::uint64_t contentHash; // hash of the word letters the matrix was built from
+};
+
+static_assert(sizeof(PatternMatrixHeader) <= 32, "patterns start right after the header");
+
+// Feedback code of every guess against every target of a dictionary, one byte per pair
+// (see BatchScorer), so solver questions become table lookups.
+// Words are numbered as the blocks of WordIndex::getWordLetters().
+class PatternMatrix
+{
+public:
+    static constexpr size_t PATTERNS_POSITION = 32;
+    static constexpr size_t MAX_MATRIX_SIZE = size_t{256} << 20; // larger dictionaries are not tabulated
+
+private:
+    int wordLength;
+    size_t wordsCount;
+    std::uint64_t contentHash;
+
+    // patterns point into either the built storage or the mapped cache file
+    std::vector<std::uint8_t> storage;
+    std::unique_ptr<MappedFile> cacheFile;
+    const std::uint8_t *patterns;
+
+    explicit PatternMatrix(std::unique_ptr<MappedFile> mappedCacheFile);
+
+    // writes through a temporary file, so a crash never leaves a half-written cache
+    void save(const std::filesystem::path &cachePath) const;
+
+public:
+    // scores every pair with all hardware threads, in tiles of guesses x targets
+    PatternMatrix(const BatchScorer &scorer, std::uint64_t contentHash);
+
+    static bool canTabulate(size_t wordsCount, int wordLength);
+
+    static std::uint64_t hashContent(std::span<const std::uint8_t> wordLetters, int wordLength);
+
+    static std::filesystem::path getCachePath(Alphabet::Language lang, int wordLength, std::uint64_t contentHash);
+
+    // maps the cache file of this word list or builds and saves it,
+    // cache files of previous versions of the list are removed
+    static std::shared_ptr<const PatternMatrix> loadOrBuild(const WordIndex &index, Alphabet::Language lang);
+
+    // removes all cache files of the language and word length
+    static void invalidate(Alphabet::Language lang, int wordLength);
+
+    int getWordLength() const { return wordLength; }
+
+    size_t getWordsCount() const { return wordsCount; }
+
+    std::uint64_t getContentHash() const { return contentHash; }
+
+    bool isMapped() const { return cacheFile != nullptr; }
+
+    std::uint8_t getPattern(size_t guessNumber, size_t targetNumber) const
+    {
+        return patterns[(guessNumber * wordsCount) + targetNumber];
+    }
+
+    // patterns of one guess against all targets
+    std::span<const std::uint8_t> getRow(size_t guessNumber) const
+    {
+        return {patterns + (guessNumber * wordsCount), wordsCount};
+    }
+
+    size_t getMemoryUsage() const { return storage.capacity() + (cacheFile ? cacheFile->getSize() : 0); }
+
+    PatternMatrix(const PatternMatrix &other) = delete;
+
+    PatternMatrix &operator=(const PatternMatrix &other) = delete;
+};
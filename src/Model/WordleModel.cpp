@@ -1,140 +1,346 @@
 #include "WordleModel.hpp"
 #include "GameState.hpp"
+#include "Solver/DecisionTree.hpp"
+#include "Solver/FeedbackScorer.hpp"
+#include "Solver/HintEngine.hpp"
+#include "Solver/HintSearch.hpp"
 #include <string>
 #define NOMINMAX
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <exception>
 #include <format>
+#include <iterator>
+#include <future>
 #include <memory>
 #include <securitybaseapi.h>
+#include <span>
+#include <string_view>
 #include <utility>
+#include <vector>
+
+// engine for the word list, nullptr if it cannot give hints
+static std::shared_ptr<const HintEngine> prepareHintEngine(std::shared_ptr<const WordIndex> index, Alphabet::Language lang,
+                                                           std::shared_ptr<const HintEngine> current)
+{
+    if (!index || !HintEngine::canHint(*index))
+    {
+        return nullptr;
+    }
+    if (current && current->getWordIndex() == index)
+    {
+        return current;
+    }
+    return std::make_shared<const HintEngine>(std::move(index), lang);
+}
+
+static std::shared_ptr<const CandidateMasks> prepareCandidateMasks(const IDictionary &dictionary,
+                                                                   std::shared_ptr<const CandidateMasks> current)
+{
+    auto index = dictionary.getWordIndex();
+    if (!index)
+    {
+        return nullptr;
+    }
+    if (current && current->getWordIndex() == index)
+    {
+        return current;
+    }
+    return std::make_shared<const CandidateMasks>(std::move(index));
+}
 
 WordleModel::WordleModel(Alphabet::Language _alphabetLanguage,
                          std::unique_ptr<IDictionary> _gameDictionary,
                          int _maxAttempts) : gameLanguage(_alphabetLanguage),
                                              gameDictionary(std::move(_gameDictionary)),
-                                             gameState(_maxAttempts, Alphabet::getAlphabet(gameLanguage),
-                                                       gameDictionary->getRandomWord())
+                                             gameState(_maxAttempts, LetterCodec::forLanguage(gameLanguage), "")
 {
+    resetGameState(gameDictionary->getRandomWord());
+    std::promise<void> readyPromise;
+    readyPromise.set_value();
+    readiness = readyPromise.get_future().share();
+
+    resetCandidates(prepareCandidateMasks(*gameDictionary, nullptr));
 }
 
-void WordleModel::startNewGame()
+WordleModel::WordleModel(Alphabet::Language _alphabetLanguage,
+                         DictionaryFactory dictionaryFactory,
+                         int _maxAttempts) : gameLanguage(_alphabetLanguage),
+                                             gameState(_maxAttempts, LetterCodec::forLanguage(gameLanguage), "")
 {
-    gameState = GameStateDTO(gameState.maxAttempts,
-                             gameState.currentAlphabet,
-                             gameDictionary->getRandomWord());
+    std::promise<void> readyPromise;
+    readiness = readyPromise.get_future().share();
+    std::promise<LoadedDictionary> loadedPromise;
+    dictionaryLoading = loadedPromise.get_future();
+
+    // the game is ready once the dictionary is loaded, the hint engine follows on the same thread
+    hintEngineLoading = std::async(std::launch::async,
+                                   [lang = gameLanguage, factory = std::move(dictionaryFactory), readyPromise = std::move(readyPromise),
+                                    loadedPromise = std::move(loadedPromise)]() mutable -> std::shared_ptr<const HintEngine>
+                                   {
+                                       std::shared_ptr<const WordIndex> index;
+                                       try
+                                       {
+                                           LoadedDictionary loaded;
+                                           loaded.dictionary = factory();
+                                           loaded.firstWord = loaded.dictionary->getRandomWord();
+                                           loaded.candidateMasks = prepareCandidateMasks(*loaded.dictionary, nullptr);
+                                           index = loaded.dictionary->getWordIndex();
+                                           loadedPromise.set_value(std::move(loaded));
+                                       }
+                                       catch (...)
+                                       {
+                                           loadedPromise.set_exception(std::current_exception());
+                                           readyPromise.set_exception(std::current_exception());
+                                           return nullptr;
+                                       }
+                                       readyPromise.set_value();
+
+                                       try
+                                       {
+                                           // the pattern matrix is built or mapped here, off the render thread
+                                           return prepareHintEngine(std::move(index), lang, nullptr);
+                                       }
+                                       catch (const std::exception &)
+                                       {
+                                           // the game works without hints
+                                           return nullptr;
+                                       }
+                                   })
+                            .share();
 }
 
-void WordleModel::checkInputWord()
+bool WordleModel::isReady()
 {
-    std::string tempLastInput;
-    for (auto &let : gameState.currentInputByLetters)
+    if (gameDictionary)
     {
-        tempLastInput += let;
+        return true;
     }
-    gameState.userGuesses.push_back(tempLastInput);
-    gameState.lastGuessStatus.clear();
-    gameState.lastGuessStatus.resize(gameState.targetWordLength);
-
-    std::map<std::string, int> targetLetterCounts;
-    for (const auto &letter : gameState.targetWordByLetters)
+    if (loadingError || readiness.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
     {
-        targetLetterCounts[letter]++;
+        return false;
     }
 
-    for (int letterIndex = 0; letterIndex < gameState.currentInputByLetters.size(); ++letterIndex)
+    // called from the SDL event filter too, so a loading error is kept instead of thrown
+    try
     {
-        const std::string &currentLetter = gameState.currentInputByLetters[letterIndex];
-        const std::string &targetLetter = gameState.targetWordByLetters[letterIndex];
-
-        if (currentLetter == targetLetter)
-        {
-            gameState.lastGuessStatus[letterIndex] = {currentLetter,
-                                                      GameStateDTO::LetterStatus::IS_IN_PLACE};
-            targetLetterCounts[currentLetter]--;
-        }
+        LoadedDictionary loaded = dictionaryLoading.get();
+        resetGameState(loaded.firstWord);
+        gameDictionary = std::move(loaded.dictionary);
+        resetCandidates(std::move(loaded.candidateMasks));
     }
+    catch (...)
+    {
+        gameDictionary.reset();
+        loadingError = std::current_exception();
+        return false;
+    }
+    return true;
+}
+
+std::exception_ptr WordleModel::getLoadingError() const
+{
+    return loadingError;
+}
+
+std::shared_future<void> WordleModel::getReadyFuture() const
+{
+    return readiness;
+}
+
+void WordleModel::startNewGame()
+{
+    cancelHintSearch();
+    resetGameState(gameDictionary->getRandomWord());
+    resetCandidates(candidates.getMasks());
+}
+
+void WordleModel::resetGameState(std::string_view wordToGuess)
+{
+    gameState.reset(wordToGuess);
+    scoreGuess = FeedbackScorer::getScoreFunction(gameState.targetWordLength);
+    hardModeRules.reset();
+}
+
+void WordleModel::resetCandidates(std::shared_ptr<const CandidateMasks> masks)
+{
+    candidates.reset(std::move(masks));
+    syncCandidates();
+}
 
-    for (int letterIndex = 0; letterIndex < gameState.currentInputByLetters.size(); ++letterIndex)
+static GameStateDTO::LetterStatus toLetterStatus(FeedbackScorer::Feedback feedback)
+{
+    switch (feedback)
     {
-        if (gameState.lastGuessStatus[letterIndex].second == GameStateDTO::LetterStatus::IS_IN_PLACE)
-        {
-            gameState.currentAlphabetStatus[gameState.currentInputByLetters[letterIndex]] = std::max(
-                gameState.lastGuessStatus[letterIndex].second,
-                gameState.currentAlphabetStatus[gameState.currentInputByLetters[letterIndex]]);
-            continue;
-        }
+    case FeedbackScorer::Feedback::CORRECT:
+        return GameStateDTO::LetterStatus::IS_IN_PLACE;
+    case FeedbackScorer::Feedback::PRESENT:
+        return GameStateDTO::LetterStatus::IS_IN_WORD_NOT_IN_PLACE;
+    case FeedbackScorer::Feedback::ABSENT:
+    default:
+        return GameStateDTO::LetterStatus::IS_NOT_IN_WORD;
+    }
+}
 
-        const std::string &currentLetter = gameState.currentInputByLetters[letterIndex];
+void WordleModel::checkInputWord()
+{
+    const int wordLength = gameState.targetWordLength;
+    const std::span<const GameStateDTO::LetterId> guessLetters = gameState.getCurrentInputLetters();
 
-        if (targetLetterCounts.contains(currentLetter) && targetLetterCounts[currentLetter] > 0)
-        {
-            gameState.lastGuessStatus[letterIndex] = {currentLetter,
-                                                      GameStateDTO::LetterStatus::IS_IN_WORD_NOT_IN_PLACE};
-            targetLetterCounts[currentLetter]--;
-        }
-        else
-        {
-            gameState.lastGuessStatus[letterIndex] = {currentLetter,
-                                                      GameStateDTO::LetterStatus::IS_NOT_IN_WORD};
-        }
+    std::array<FeedbackScorer::Feedback, FeedbackScorer::MAX_WORD_LENGTH> feedback{};
+    const FeedbackScorer::PatternCode patternCode =
+        scoreGuess != nullptr ? scoreGuess(guessLetters.data(), gameState.targetWord.data(), feedback.data())
+                              : FeedbackScorer::score(guessLetters, gameState.getTargetLetters(),
+                                                      std::span(feedback).first(wordLength));
+
+    cancelHintSearch();
+    gameState.clearHint();
+
+    GameStateDTO::Guess &guess = gameState.guesses[gameState.guessesCount++];
+    guess.letters = gameState.currentInput;
+    guess.patternCode = patternCode;
+    for (int letterIndex = 0; letterIndex < wordLength; ++letterIndex)
+    {
+        const GameStateDTO::LetterStatus status = toLetterStatus(feedback[letterIndex]);
+        guess.statuses[letterIndex] = status;
 
-        gameState.currentAlphabetStatus[currentLetter] = std::max(
-            gameState.lastGuessStatus[letterIndex].second,
-            gameState.currentAlphabetStatus[currentLetter]);
+        GameStateDTO::LetterStatus &keyStatus = gameState.letterStatuses[guessLetters[letterIndex]];
+        keyStatus = std::max(status, keyStatus);
     }
+    hardModeRules.addGuess(guessLetters, gameState.getGuessStatuses(gameState.guessesCount - 1));
+
+    if (candidates.getMasks())
+    {
+        candidates.narrow(guessLetters, std::span(feedback).first(wordLength));
+    }
+    syncCandidates();
 
-    gameState.userGuessesStatuses.push_back(gameState.lastGuessStatus);
     if (isGameOver())
     {
         gameState.isGameFinished = true;
-        gameState.finalMessage = isUserWin() ? gameState.WIN_MESSAGE : gameState.LOSE_MESSAGE;
+        if (isUserWin())
+        {
+            gameState.finalMessage = GameStateDTO::WIN_MESSAGE;
+        }
+        else
+        {
+            gameState.finalMessage = GameStateDTO::LOSE_MESSAGE;
+            gameState.appendWord(gameState.finalMessage, gameState.getTargetLetters());
+        }
     }
 }
 
 bool WordleModel::isValidInput()
 {
     bool res = false;
-    if (gameState.currentInputByLetters.size() == gameState.targetWordLength)
+    gameState.suggestions.clear();
+    if (gameState.currentInputLength == gameState.targetWordLength)
     {
-        for (const auto &currentInputByLetter : gameState.currentInputByLetters)
+        if (std::ranges::find(gameState.getCurrentInputLetters(), GameStateDTO::NO_LETTER) !=
+            gameState.getCurrentInputLetters().end())
         {
-            if (!gameState.currentAlphabetStatus.contains(currentInputByLetter))
-            {
-                gameState.errorMessage = "Содержатся символы, не входящие в алфавит.";
-                return res;
-            }
+            gameState.errorMessage = "Содержатся символы, не входящие в алфавит.";
+            return res;
+        }
+        if (gameState.isHardMode && !checkHardModeRules())
+        {
+            return res;
         }
         if (!gameDictionary->isValidWord(gameState.getCurrentInputString()))
         {
             gameState.errorMessage = "Такого слова нет в словаре для текущего языка.";
+            for (const std::string &suggestion : gameDictionary->getSuggestions(gameState.getCurrentInputString(), MAX_SUGGESTIONS))
+            {
+                gameState.suggestions.emplace_back(suggestion);
+            }
             return res;
         }
+        gameState.errorMessage.clear();
         res = true;
     }
     else
     {
-        gameState.errorMessage = std::format("Длина слова должна быть {} букв.", gameState.targetWordLength);
+        gameState.errorMessage.clear();
+        std::format_to(std::back_inserter(gameState.errorMessage), "Длина слова должна быть {} букв.",
+                       gameState.targetWordLength);
     }
     return res;
 }
 
 void WordleModel::modifyCurrentInput(const std::string &input)
 {
+    // the message of a rejected guess stays until the next word is typed
+    if (!input.empty())
+    {
+        cancelHintSearch();
+        gameState.errorMessage.clear();
+        gameState.suggestions.clear();
+    }
     gameState.setCurrentInput(input);
 }
 
 bool WordleModel::isGameOver() const
 {
-    return gameState.userGuesses.size() == gameState.maxAttempts || this->isUserWin();
+    return gameState.guessesCount == gameState.maxAttempts || this->isUserWin();
 }
 
 bool WordleModel::isUserWin() const
 {
-    if (gameState.userGuesses.empty())
+    if (gameState.guessesCount == 0)
     {
         return false;
     }
-    return gameState.targetWord == gameState.userGuesses.back();
+    return std::ranges::equal(gameState.getGuessLetters(gameState.guessesCount - 1), gameState.getTargetLetters());
+}
+
+bool WordleModel::checkHardModeRules()
+{
+    const HardModeRules::Check check = hardModeRules.check(gameState.getCurrentInputLetters());
+    switch (check.violation)
+    {
+    case HardModeRules::Violation::LETTER_NOT_IN_PLACE:
+        gameState.errorMessage.clear();
+        std::format_to(std::back_inserter(gameState.errorMessage), "Сложный режим: {}-я буква должна быть {}.",
+                       check.position + 1, gameState.getUpperLetter(check.letter));
+        return false;
+    case HardModeRules::Violation::LETTER_MISSING:
+        gameState.errorMessage.clear();
+        if (check.copies == 1)
+        {
+            std::format_to(std::back_inserter(gameState.errorMessage), "Сложный режим: в слове должна быть буква {}.",
+                           gameState.getUpperLetter(check.letter));
+        }
+        else
+        {
+            std::format_to(std::back_inserter(gameState.errorMessage), "Сложный режим: буква {} должна встречаться не менее {} раз.",
+                           gameState.getUpperLetter(check.letter), check.copies);
+        }
+        return false;
+    case HardModeRules::Violation::NONE:
+    default:
+        return true;
+    }
+}
+
+void WordleModel::setHardMode(bool isEnabled)
+{
+    if (gameState.isHardMode == isEnabled)
+    {
+        return;
+    }
+    gameState.isHardMode = isEnabled;
+
+    // the hint shown or being searched may not be a legal guess any more, or miss a better one
+    if (hintSearch || !gameState.hint.word.empty())
+    {
+        requestHint(hintTimeBudget);
+    }
+}
+
+bool WordleModel::isHardMode() const
+{
+    return gameState.isHardMode;
 }
 
 GameStateDTO &WordleModel::getGameState()
@@ -142,11 +348,187 @@ GameStateDTO &WordleModel::getGameState()
     return gameState;
 }
 
+DictionaryReloadStats WordleModel::getDictionaryReloadStats() const
+{
+    // the dictionary is not adopted until isReady()
+    if (!gameDictionary)
+    {
+        return {};
+    }
+    return gameDictionary->getReloadStats();
+}
+
+std::shared_ptr<const WordIndex> WordleModel::getWordIndex() const
+{
+    return gameDictionary ? gameDictionary->getWordIndex() : nullptr;
+}
+
+void WordleModel::syncCandidates()
+{
+    auto masks = prepareCandidateMasks(*gameDictionary, candidates.getMasks());
+    if (masks != candidates.getMasks())
+    {
+        // a reload renumbers the words, the new list is narrowed by every guess again
+        candidates.reset(masks);
+        const int wordLength = gameState.targetWordLength;
+        std::array<FeedbackScorer::Feedback, FeedbackScorer::MAX_WORD_LENGTH> feedback{};
+        for (int guessNumber = 0; masks && guessNumber < gameState.guessesCount; ++guessNumber)
+        {
+            FeedbackScorer::decode(gameState.guesses[guessNumber].patternCode, std::span(feedback).first(wordLength));
+            candidates.narrow(gameState.getGuessLetters(guessNumber), std::span(feedback).first(wordLength));
+        }
+    }
+    gameState.remainingCandidatesCount = masks ? static_cast<int>(candidates.getCount()) : -1;
+}
+
+// tree node for the guesses played so far, nullptr once the player left the tree's strategy
+static const DecisionTreeNode *followDecisionTree(const DecisionTree &tree, const HintEngine &engine,
+                                                  const GameStateDTO &state)
+{
+    const DecisionTreeNode *node = &tree.getRoot();
+    for (int guessNumber = 0; node != nullptr && guessNumber < state.guessesCount; ++guessNumber)
+    {
+        if (!std::ranges::equal(engine.getWordLetters(node->guessNumber), state.getGuessLetters(guessNumber)))
+        {
+            return nullptr;
+        }
+        node = tree.getChild(*node, state.guesses[guessNumber].patternCode);
+    }
+    return node;
+}
+
+void WordleModel::requestHint(std::chrono::milliseconds timeBudget)
+{
+    if (!gameDictionary || gameState.isGameFinished)
+    {
+        return;
+    }
+
+    cancelHintSearch();
+    gameState.clearHint();
+    hintTimeBudget = timeBudget;
+    syncCandidates();
+    adoptHintEngine();
+    const std::shared_ptr<const CandidateMasks> &masks = candidates.getMasks();
+    if (!masks)
+    {
+        return;
+    }
+
+    // answers that need no search are given at once; the tree's guesses ignore the hard mode
+    if (hintEngine && hintEngine->getWordIndex() == masks->getWordIndex())
+    {
+        if (const DecisionTree *tree = hintEngine->getDecisionTree(); tree != nullptr && !gameState.isHardMode)
+        {
+            if (const DecisionTreeNode *node = followDecisionTree(*tree, *hintEngine, gameState))
+            {
+                gameState.setHint(hintEngine->getWord(node->guessNumber), node->expectedRemaining);
+                return;
+            }
+        }
+        if (gameState.guessesCount == 0)
+        {
+            const HintEngine::Ranking &ranking = hintEngine->getOpeningRanking();
+            gameState.setHint(hintEngine->getWord(ranking.guessNumber), ranking.expectedRemaining);
+            return;
+        }
+    }
+
+    std::vector<std::uint32_t> candidateNumbers;
+    candidates.collect(candidateNumbers);
+    if (candidateNumbers.empty())
+    {
+        // no candidate fits the feedback, e.g. the target is missing from the answers
+        return;
+    }
+
+    // in the hard mode only the guesses Enter would accept are rated
+    HintSearch::GuessFilter guessFilter;
+    if (gameState.isHardMode)
+    {
+        guessFilter = [rules = hardModeRules](std::span<const std::uint8_t> letters)
+        {
+            return rules.check(letters).violation == HardModeRules::Violation::NONE;
+        };
+    }
+
+    // after a reload the pattern matrix is rebuilt by the search, off the render thread; while
+    // the first engine is still being built the search waits for it instead of building another
+    hintSearch = std::make_unique<HintSearch>(
+        [index = masks->getWordIndex(), lang = gameLanguage, current = hintEngine, loading = hintEngineLoading]()
+        {
+            return prepareHintEngine(index, lang, current || !loading.valid() ? current : loading.get());
+        },
+        std::move(candidateNumbers), timeBudget, std::move(guessFilter));
+}
+
+const GameHint &WordleModel::getHint()
+{
+    adoptHintEngine();
+    std::erase_if(cancelledSearches, [](const std::unique_ptr<HintSearch> &search)
+                  { return search->isFinished(); });
+
+    if (!hintSearch)
+    {
+        return gameState.hint;
+    }
+
+    const HintSearch::Progress progress = hintSearch->getProgress();
+    if (progress.best)
+    {
+        const double searchProgress = static_cast<double>(progress.ratedCount) / static_cast<double>(progress.guessesCount);
+        gameState.setHint(progress.engine->getWord(progress.best->guessNumber), progress.best->expectedRemaining,
+                          searchProgress);
+    }
+    if (progress.isFinished)
+    {
+        // the next hint for this word list needs no rebuild
+        if (progress.engine && candidates.getMasks() && progress.engine->getWordIndex() == candidates.getMasks()->getWordIndex())
+        {
+            hintEngine = progress.engine;
+        }
+        hintSearch.reset();
+    }
+    return gameState.hint;
+}
+
+void WordleModel::adoptHintEngine()
+{
+    if (hintEngineLoading.valid() && hintEngineLoading.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        if (!hintEngine)
+        {
+            hintEngine = hintEngineLoading.get();
+        }
+        hintEngineLoading = {};
+    }
+}
+
+void WordleModel::cancelHintSearch()
+{
+    if (hintSearch)
+    {
+        hintSearch->cancel();
+        cancelledSearches.push_back(std::move(hintSearch));
+    }
+}
+
 WordleModel::~WordleModel() = default;
 
 WordleModel::WordleModel(WordleModel &&other) noexcept : gameLanguage(other.gameLanguage),
                                                          gameDictionary(std::move(other.gameDictionary)),
-                                                         gameState(std::move(other.gameState))
+                                                         gameState(std::move(other.gameState)),
+                                                         scoreGuess(other.scoreGuess),
+                                                         hardModeRules(other.hardModeRules),
+                                                         hintTimeBudget(other.hintTimeBudget),
+                                                         hintEngine(std::move(other.hintEngine)),
+                                                         candidates(std::move(other.candidates)),
+                                                         hintSearch(std::move(other.hintSearch)),
+                                                         cancelledSearches(std::move(other.cancelledSearches)),
+                                                         dictionaryLoading(std::move(other.dictionaryLoading)),
+                                                         hintEngineLoading(std::move(other.hintEngineLoading)),
+                                                         readiness(std::move(other.readiness)),
+                                                         loadingError(std::move(other.loadingError))
 {
 }
 
@@ -157,6 +539,17 @@ WordleModel &WordleModel::operator=(WordleModel &&other) noexcept
         std::swap(gameLanguage, other.gameLanguage);
         std::swap(gameDictionary, other.gameDictionary);
         std::swap(gameState, other.gameState);
+        std::swap(scoreGuess, other.scoreGuess);
+        std::swap(hardModeRules, other.hardModeRules);
+        std::swap(hintTimeBudget, other.hintTimeBudget);
+        std::swap(hintEngine, other.hintEngine);
+        std::swap(candidates, other.candidates);
+        std::swap(hintSearch, other.hintSearch);
+        std::swap(cancelledSearches, other.cancelledSearches);
+        std::swap(dictionaryLoading, other.dictionaryLoading);
+        std::swap(hintEngineLoading, other.hintEngineLoading);
+        std::swap(readiness, other.readiness);
+        std::swap(loadingError, other.loadingError);
     }
     return *this;
 }
\ No newline at end of file
@@ -1,22 +1,89 @@
 #pragma once
 
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "Dictionary/IDictionary.hpp"
 #include "GameState.hpp"
+#include "HardModeRules.hpp"
 #include "IGameModel.hpp"
+#include "Solver/CandidateSet.hpp"
+#include "Solver/FeedbackScorer.hpp"
+
+class HintEngine;
+class HintSearch;
 
 class WordleModel : public IGameModel
 {
+public:
+    static constexpr size_t MAX_SUGGESTIONS = GameStateDTO::MAX_SUGGESTIONS;
+
+    using DictionaryFactory = std::function<std::unique_ptr<IDictionary>()>;
+
 private:
+    struct LoadedDictionary
+    {
+        std::unique_ptr<IDictionary> dictionary;
+        std::string firstWord;
+        std::shared_ptr<const CandidateMasks> candidateMasks;
+    };
+
     Alphabet::Language gameLanguage;
     std::unique_ptr<IDictionary> gameDictionary;
     GameStateDTO gameState;
+    FeedbackScorer::ScoreFunction scoreGuess = nullptr; // compiled for the target length, generic scoring if nullptr
+    HardModeRules hardModeRules;                        // follows every guess, enforced in hard mode only
+    std::chrono::milliseconds hintTimeBudget{0};        // of the last hint request, reused when the hard mode changes
+
+    // rebuilt when the dictionary publishes a new word list
+    std::shared_ptr<const HintEngine> hintEngine;
+    CandidateSet candidates;
+
+    // the running hint search and cancelled ones still finishing their current task
+    std::unique_ptr<HintSearch> hintSearch;
+    std::vector<std::unique_ptr<HintSearch>> cancelledSearches;
+
+    // background dictionary loading, then the hint engine of its word list, adopted when it is done
+    std::future<LoadedDictionary> dictionaryLoading;
+    std::shared_future<std::shared_ptr<const HintEngine>> hintEngineLoading;
+    std::shared_future<void> readiness;
+    std::exception_ptr loadingError; // the dictionary failed to load, the model never becomes ready
+
+    // a new game in place, with the scorer of the word's length
+    void resetGameState(std::string_view wordToGuess);
+
+    // writes the error message if the input ignores a revealed hint
+    bool checkHardModeRules();
+
+    // follows the dictionary's word list, a new list is narrowed again by all guesses played
+    void syncCandidates();
+
+    void resetCandidates(std::shared_ptr<const CandidateMasks> masks);
+
+    // takes the hint engine built after loading once it is done, without waiting for it
+    void adoptHintEngine();
+
+    // leaves the hint found so far, the search threads wind down on their own
+    void cancelHintSearch();
 
 public:
     WordleModel(Alphabet::Language alphabetLanguage, std::unique_ptr<IDictionary> gameDictionary, int maxAttempts);
 
+    // builds the dictionary on a worker thread, the model is usable once isReady() returns true
+    WordleModel(Alphabet::Language alphabetLanguage, DictionaryFactory dictionaryFactory, int maxAttempts);
+
+    bool isReady() override;
+
+    [[nodiscard]] std::shared_future<void> getReadyFuture() const override;
+
+    [[nodiscard]] std::exception_ptr getLoadingError() const override;
+
     void startNewGame() override;
 
     void checkInputWord() override;
@@ -31,6 +98,19 @@ public:
 
     [[nodiscard]] GameStateDTO &getGameState() override;
 
+    void setHardMode(bool isEnabled) override;
+
+    bool isHardMode() const override;
+
+    [[nodiscard]] DictionaryReloadStats getDictionaryReloadStats() const override;
+
+    // word list of the dictionary, nullptr until it is loaded or if the dictionary keeps none
+    [[nodiscard]] std::shared_ptr<const WordIndex> getWordIndex() const;
+
+    void requestHint(std::chrono::milliseconds timeBudget) override;
+
+    const GameHint &getHint() override;
+
     ~WordleModel();
 
     WordleModel(WordleModel &&other) noexcept;
@@ -1,4 +1,5 @@
 #include "DebugOverlay.hpp"
+#include <format>
 #include <string>
 
 DebugOverlay::DebugOverlay(SDL_Renderer *_renderer, AssetManager &_assets, TTF_TextEngine *_engine)
@@ -23,9 +24,14 @@ void DebugOverlay::clearTextCaches()
         TTF_DestroyText(c_debugMSText);
         c_debugMSText = nullptr;
     }
+    if (c_debugReloadText != nullptr)
+    {
+        TTF_DestroyText(c_debugReloadText);
+        c_debugReloadText = nullptr;
+    }
 }
 
-void DebugOverlay::render(int fps, int msPerFrame)
+void DebugOverlay::render(int fps, int msPerFrame, const DictionaryReloadStats &reloadStats)
 {
     const std::string DEBUG_FONT_NAME = "debug_font";
     const int DEBUG_FONT_PTSIZE = 20;
@@ -49,6 +55,11 @@ void DebugOverlay::render(int fps, int msPerFrame)
         c_debugMSText = TTF_CreateText(c_textEngine, debugFont, "Frame: ...", 0);
         TTF_SetTextColor(c_debugMSText, TEXT_COLOR.r, TEXT_COLOR.g, TEXT_COLOR.b, TEXT_COLOR.a);
     }
+    if (c_debugReloadText == nullptr)
+    {
+        c_debugReloadText = TTF_CreateText(c_textEngine, debugFont, "Dict reloads: ...", 0);
+        TTF_SetTextColor(c_debugReloadText, TEXT_COLOR.r, TEXT_COLOR.g, TEXT_COLOR.b, TEXT_COLOR.a);
+    }
 
     if (fps != c_cachedFPS)
     {
@@ -64,6 +75,15 @@ void DebugOverlay::render(int fps, int msPerFrame)
         c_cachedMS = msPerFrame;
     }
 
+    // timings only change together with the counter
+    if (reloadStats.reloadsCount != c_cachedReloadsCount)
+    {
+        std::string reloadText = std::format("Dict reloads: {}, rebuild {:.1f} ms, swap {:.1f} us",
+                                             reloadStats.reloadsCount, reloadStats.rebuildMs, reloadStats.swapUs);
+        TTF_SetTextString(c_debugReloadText, reloadText.c_str(), 0);
+        c_cachedReloadsCount = reloadStats.reloadsCount;
+    }
+
     const int MARGIN_X = 10;
     const int MARGIN_Y = 10;
     const int LINE_SPACING = 5;
@@ -74,4 +94,5 @@ void DebugOverlay::render(int fps, int msPerFrame)
 
     TTF_DrawRendererText(c_debugFPSText, (float)MARGIN_X, (float)MARGIN_Y);
     TTF_DrawRendererText(c_debugMSText, (float)MARGIN_X, (float)MARGIN_Y + fspH + LINE_SPACING);
+    TTF_DrawRendererText(c_debugReloadText, (float)MARGIN_X, (float)MARGIN_Y + (2 * (fspH + LINE_SPACING)));
 }
\ No newline at end of file
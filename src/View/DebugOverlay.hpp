@@ -3,6 +3,7 @@
 #include "SDL3/SDL_render.h"
 #include "SDL3_ttf/SDL_ttf.h"
 
+#include "../Model/Dictionary/IDictionary.hpp"
 #include "AssetManager.hpp"
 
 class DebugOverlay
@@ -17,6 +18,8 @@ private:
     int c_cachedMS = -1;
     TTF_Text *c_debugFPSText = nullptr;
     TTF_Text *c_debugMSText = nullptr;
+    int c_cachedReloadsCount = -1;
+    TTF_Text *c_debugReloadText = nullptr;
 
     void clearTextCaches();
 
@@ -24,5 +27,5 @@ public:
     DebugOverlay(SDL_Renderer *_renderer, AssetManager &_assets, TTF_TextEngine *_engine);
     ~DebugOverlay();
 
-    void render(int fps, int msPerFrame);
+    void render(int fps, int msPerFrame, const DictionaryReloadStats &reloadStats);
 };
\ No newline at end of file
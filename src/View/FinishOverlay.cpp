@@ -1,6 +1,7 @@
 #include "FinishOverlay.hpp"
 #include "SDL3/SDL_rect.h"
 #include <string>
+#include <string_view>
 
 static int findOptimalFontSize(TTF_Text *textObject, const std::string &fontName, AssetManager &assets,
                                int minPT, int maxPT, int targetWidth, int targetHeight)
@@ -66,7 +67,7 @@ void FinishOverlay::render(const GameStateDTO &state, const LayoutMetrics &metri
         return;
     }
 
-    if (c_cachedTitleFontSizePT == 0 || c_cachedRestartFontSizePT == 0 || c_cachedTitleMessage != state.finalMessage)
+    if (c_cachedTitleFontSizePT == 0 || c_cachedRestartFontSizePT == 0 || c_cachedTitleMessage != std::string_view(state.finalMessage))
     {
         c_cachedTitleMessage = state.finalMessage;
         calculateAndCacheOverlayFontSizes(state, metrics);
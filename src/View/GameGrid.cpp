@@ -1,7 +1,20 @@
 #include "GameGrid.hpp"
 #include "ViewUtils.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
 #include <string>
 
+using RowStatuses = std::array<CharStatus, GameStateDTO::MAX_WORD_LENGTH>;
+
+// statuses of a guess row, kept on the stack
+static RowStatuses toRowStatuses(const GameStateDTO &state, int guessIndex)
+{
+    RowStatuses statuses{};
+    std::ranges::transform(state.getGuessStatuses(guessIndex), statuses.begin(), toCharStatus);
+    return statuses;
+}
+
 GameGrid::GameGrid(SDL_Renderer *_renderer, AssetManager &_assets, TTF_TextEngine *_engine,
                    const LayoutMetrics &_metrics, const TTF_Font *_gridFont, const GameStateDTO &state)
     : renderer(_renderer), textEngine(_engine), metrics(_metrics),
@@ -21,18 +34,11 @@ GameGrid::GameGrid(SDL_Renderer *_renderer, AssetManager &_assets, TTF_TextEngin
     int currentRowIndex = 0;
 
     // guesses history
-    const int HISTORY_COUNT = state.userGuesses.size();
+    const int HISTORY_COUNT = state.guessesCount;
     for (int i = 0; i < HISTORY_COUNT; ++i)
     {
-        std::vector<CharStatus> statuses;
-        const auto &guess = state.userGuessesStatuses[i];
-        statuses.reserve(guess.size());
-        for (const auto &chr : guess)
-        {
-            statuses.push_back(toCharStatus(chr.second));
-        }
-        statuses.resize(state.targetWordLength, CharStatus::ABSENT);
-        wordRows[i].setStatuses(state.userGuesses[i], statuses);
+        const RowStatuses statuses = toRowStatuses(state, i);
+        wordRows[i].setStatuses(state.getGuessString(i), std::span(statuses).first(targetWordLength));
         currentRowIndex = i + 1;
     }
     c_cachedGuessCount = currentRowIndex;
@@ -60,20 +66,13 @@ void GameGrid::render(const GameStateDTO &state)
     }
 
     // guess history
-    int newGuessCount = state.userGuesses.size();
+    int newGuessCount = state.guessesCount;
     if (newGuessCount > c_cachedGuessCount)
     {
         int rowIndexToUpdate = c_cachedGuessCount;
-        const auto &guessStatus = state.userGuessesStatuses[rowIndexToUpdate];
-        std::vector<CharStatus> statuses;
-        statuses.reserve(guessStatus.size());
-        for (const auto &chr : guessStatus)
-        {
-            statuses.push_back(toCharStatus(chr.second));
-        }
-        statuses.resize(targetWordLength, CharStatus::ABSENT);
-
-        wordRows[rowIndexToUpdate].setStatuses(state.userGuesses[rowIndexToUpdate], statuses);
+        const RowStatuses statuses = toRowStatuses(state, rowIndexToUpdate);
+        wordRows[rowIndexToUpdate].setStatuses(state.getGuessString(rowIndexToUpdate),
+                                               std::span(statuses).first(targetWordLength));
 
         c_cachedGuessCount = newGuessCount;
     }
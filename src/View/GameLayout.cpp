@@ -30,8 +30,9 @@ LayoutMetrics GameLayout::calculateMetrics() const
     const float TOTAL_HEIGHT_RATIO = 0.90f;
     const float AVAILABLE_HEIGHT_FOR_LAYOUT = windowHeight * TOTAL_HEIGHT_RATIO;
 
-    const float GRID_TO_TOTAL_HEIGHT_RATIO = 0.65f;
-    const float KEYBOARD_TO_TOTAL_HEIGHT_RATIO = 1.0f - GRID_TO_TOTAL_HEIGHT_RATIO;
+    const float GRID_TO_TOTAL_HEIGHT_RATIO = 0.62f;
+    const float STATUS_LINE_TO_TOTAL_HEIGHT_RATIO = 0.05f;
+    const float KEYBOARD_TO_TOTAL_HEIGHT_RATIO = 1.0f - GRID_TO_TOTAL_HEIGHT_RATIO - STATUS_LINE_TO_TOTAL_HEIGHT_RATIO;
 
     // grid height calculate
     float availableHeightForGrid = AVAILABLE_HEIGHT_FOR_LAYOUT * GRID_TO_TOTAL_HEIGHT_RATIO;
@@ -43,6 +44,9 @@ LayoutMetrics GameLayout::calculateMetrics() const
 
     float actualGridHeight = (MAX_GUESSES_ROWS * m.rowHeight) + ((MAX_GUESSES_ROWS - 1) * m.rowSpacing);
 
+    // status line between grid and keyboard
+    m.statusLineHeight = AVAILABLE_HEIGHT_FOR_LAYOUT * STATUS_LINE_TO_TOTAL_HEIGHT_RATIO;
+
     // keyboard height calculate
     float availableHeightForKeyboard = AVAILABLE_HEIGHT_FOR_LAYOUT * KEYBOARD_TO_TOTAL_HEIGHT_RATIO;
     const int KEYBOARD_NUM_ROWS = 3;
@@ -54,10 +58,11 @@ LayoutMetrics GameLayout::calculateMetrics() const
     m.startX = (windowWidth - actualGridWidth) / 2.0F;
 
     // calculate vertical position
-    float totalLayoutHeight = actualGridHeight + m.rowSpacing + actualKeyboardHeight;
+    float totalLayoutHeight = actualGridHeight + m.rowSpacing + m.statusLineHeight + m.rowSpacing + actualKeyboardHeight;
     m.startY = (windowHeight - totalLayoutHeight) / 2.0F;
 
-    m.keyboardStartY = m.startY + actualGridHeight + m.rowSpacing;
+    m.statusLineY = m.startY + actualGridHeight + m.rowSpacing;
+    m.keyboardStartY = m.statusLineY + m.statusLineHeight + m.rowSpacing;
     m.keyboardCenterX = (float)windowWidth / 2.0f;
 
     // calculate width of keys in keyboard
@@ -71,6 +76,7 @@ LayoutMetrics GameLayout::calculateMetrics() const
     // font size for grid and keyboard
     m.fontSizePT = (int)std::round(m.rowHeight * 0.7f);
     m.keyboardFontSizePT = (int)std::round(m.keyHeight * 0.4f);
+    m.statusLineFontSizePT = (int)std::round(m.statusLineHeight * 0.5f);
 
     // ====================================================================
     // --- 2. CALCULATE END GAME MESSAGE ---
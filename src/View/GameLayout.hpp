@@ -22,6 +22,11 @@ struct LayoutMetrics
     float keyboardCenterX;
     int keyboardFontSizePT;
 
+    // status line
+    float statusLineY;
+    float statusLineHeight;
+    int statusLineFontSizePT;
+
     // overlay
     float overlayBoxX;
     float overlayBoxY;
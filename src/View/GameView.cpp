@@ -9,6 +9,7 @@
 #include "GameGrid.hpp"
 #include "GameLayout.hpp"
 #include "KeyboardDisplay.hpp"
+#include "StatusLine.hpp"
 
 GameView::GameView(SDL_Renderer *_renderer, AssetManager &_assets)
     : renderer(_renderer), assets(_assets),
@@ -24,6 +25,10 @@ GameView::GameView(SDL_Renderer *_renderer, AssetManager &_assets)
 
 GameView::~GameView()
 {
+    if (c_loadingText != nullptr)
+    {
+        TTF_DestroyText(c_loadingText);
+    }
     if (c_textEngine != nullptr)
     {
         TTF_DestroyRendererTextEngine(c_textEngine);
@@ -34,6 +39,7 @@ void GameView::clearTextCaches()
 {
     c_cachedGridFontSizePT = 0;
     c_cachedKeyboardFontSizePT = 0;
+    c_cachedStatusLineFontSizePT = 0;
 }
 
 void GameView::rebuildUI(const GameStateDTO &state)
@@ -45,8 +51,10 @@ void GameView::rebuildUI(const GameStateDTO &state)
     // 2. fonts loading
     const int CHARBOX_PTSIZE = metrics.fontSizePT;
     const int KEYBOARD_PTSIZE = metrics.keyboardFontSizePT;
+    const int STATUS_LINE_PTSIZE = metrics.statusLineFontSizePT;
     const std::string GRID_FONT_NAME = "grid_font";
     const std::string KEYBOARD_FONT_NAME = "keyboard_font";
+    const std::string STATUS_LINE_FONT_NAME = "status_line_font";
     if (c_cachedGridFontSizePT != CHARBOX_PTSIZE)
     {
         assets.loadFonts(GRID_FONT_NAME, DATA_DIR "/fonts/arial.ttf", CHARBOX_PTSIZE);
@@ -57,9 +65,15 @@ void GameView::rebuildUI(const GameStateDTO &state)
         assets.loadFonts(KEYBOARD_FONT_NAME, DATA_DIR "/fonts/arial.ttf", KEYBOARD_PTSIZE);
         c_cachedKeyboardFontSizePT = KEYBOARD_PTSIZE;
     }
+    if (c_cachedStatusLineFontSizePT != STATUS_LINE_PTSIZE)
+    {
+        assets.loadFonts(STATUS_LINE_FONT_NAME, DATA_DIR "/fonts/arial.ttf", STATUS_LINE_PTSIZE);
+        c_cachedStatusLineFontSizePT = STATUS_LINE_PTSIZE;
+    }
 
     const TTF_Font *gridFont = assets.getFont(GRID_FONT_NAME);
     const TTF_Font *keyboardFont = assets.getFont(KEYBOARD_FONT_NAME);
+    const TTF_Font *statusLineFont = assets.getFont(STATUS_LINE_FONT_NAME);
     if (gridFont == nullptr || keyboardFont == nullptr)
     {
         SDL_Log("GameView::rebuildUI: Fonts are not loaded.");
@@ -69,6 +83,7 @@ void GameView::rebuildUI(const GameStateDTO &state)
     // 3. clear all cache and components
     grid.reset();
     keyboard.reset();
+    statusLine.reset();
     finishOverlay.reset();
     debugOverlay.reset();
     clearTextCaches();
@@ -76,6 +91,7 @@ void GameView::rebuildUI(const GameStateDTO &state)
     // 4. create components
     grid = std::make_unique<GameGrid>(renderer, assets, c_textEngine, metrics, gridFont, state);
     keyboard = std::make_unique<KeyboardDisplay>(renderer, c_textEngine, metrics, keyboardFont, state);
+    statusLine = std::make_unique<StatusLine>(renderer, c_textEngine, metrics, statusLineFont);
     finishOverlay = std::make_unique<FinishOverlay>(renderer, assets, c_textEngine);
     debugOverlay = std::make_unique<DebugOverlay>(renderer, assets, c_textEngine);
 }
@@ -95,7 +111,7 @@ void GameView::render(const GameStateDTO &state)
         rebuildUI(state);
     }
 
-    if (!grid || !keyboard || !finishOverlay)
+    if (!grid || !keyboard || !statusLine || !finishOverlay)
     {
         SDL_Log("UI components not initialized, skipping render.");
         return;
@@ -106,15 +122,66 @@ void GameView::render(const GameStateDTO &state)
     SDL_RenderClear(renderer);
 
     grid->render(state);
-    keyboard->render(state.currentAlphabetStatus);
+    keyboard->render(state.letterStatuses);
+    statusLine->render(state);
 
     finishOverlay->render(state, metrics);
 }
 
-void GameView::renderDebugInfo(int fps, int msPerFrame)
+void GameView::renderLoading(const char *failure)
+{
+    const std::string LOADING_FONT_NAME = "loading_font";
+    const int LOADING_FONT_PTSIZE = 64;
+    const std::string LOADING_MSG = "Загрузка словаря...";
+    const std::string FAILURE_MSG = "Не удалось загрузить словарь: ";
+    const SDL_Color TEXT_COLOR = {255, 255, 255, 255};
+
+    SDL_SetRenderDrawColor(renderer, BACKGROUND_COLOR.r, BACKGROUND_COLOR.g,
+                           BACKGROUND_COLOR.b, BACKGROUND_COLOR.a);
+    SDL_RenderClear(renderer);
+
+    SDL_RendererLogicalPresentation mode{SDL_LOGICAL_PRESENTATION_LETTERBOX};
+    SDL_GetRenderLogicalPresentation(renderer, &logicalWidth, &logicalHeight, &mode);
+
+    // the placeholder is replaced once by the error, which stays until the game is closed
+    if (failure != nullptr && !c_isLoadingFailureShown && c_loadingText != nullptr)
+    {
+        TTF_DestroyText(c_loadingText);
+        c_loadingText = nullptr;
+    }
+    if (c_loadingText == nullptr && c_textEngine != nullptr)
+    {
+        assets.loadFonts(LOADING_FONT_NAME, DATA_DIR "/fonts/arial.ttf", LOADING_FONT_PTSIZE);
+        auto *loadingFont = const_cast<TTF_Font *>(assets.getFont(LOADING_FONT_NAME));
+        if (loadingFont == nullptr)
+        {
+            return;
+        }
+        const std::string message = failure != nullptr ? FAILURE_MSG + failure : LOADING_MSG;
+        c_loadingText = TTF_CreateText(c_textEngine, loadingFont, message.c_str(), 0);
+        if (c_loadingText == nullptr)
+        {
+            return;
+        }
+        TTF_SetTextColor(c_loadingText, TEXT_COLOR.r, TEXT_COLOR.g, TEXT_COLOR.b, TEXT_COLOR.a);
+        TTF_SetTextWrapWidth(c_loadingText, logicalWidth);
+        c_isLoadingFailureShown = failure != nullptr;
+    }
+    if (c_loadingText == nullptr)
+    {
+        return;
+    }
+
+    int textW = 0;
+    int textH = 0;
+    TTF_GetTextSize(c_loadingText, &textW, &textH);
+    TTF_DrawRendererText(c_loadingText, (logicalWidth - textW) / 2.0f, (logicalHeight - textH) / 2.0f);
+}
+
+void GameView::renderDebugInfo(int fps, int msPerFrame, const DictionaryReloadStats &reloadStats)
 {
     if (debugOverlay)
     {
-        debugOverlay->render(fps, msPerFrame);
+        debugOverlay->render(fps, msPerFrame, reloadStats);
     }
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "GameGrid.hpp"
 #include "GameLayout.hpp"
 #include "KeyboardDisplay.hpp"
+#include "StatusLine.hpp"
 
 class GameView
 {
@@ -32,6 +33,7 @@ private:
     // ui components
     std::unique_ptr<GameGrid> grid;
     std::unique_ptr<KeyboardDisplay> keyboard;
+    std::unique_ptr<StatusLine> statusLine;
     std::unique_ptr<FinishOverlay> finishOverlay;
     std::unique_ptr<DebugOverlay> debugOverlay;
 
@@ -45,6 +47,11 @@ private:
     // font's cache
     int c_cachedGridFontSizePT = 0;
     int c_cachedKeyboardFontSizePT = 0;
+    int c_cachedStatusLineFontSizePT = 0;
+
+    // placeholder shown while the dictionary is loading, or the reason it failed to load
+    TTF_Text *c_loadingText = nullptr;
+    bool c_isLoadingFailureShown = false;
 
     void rebuildUI(const GameStateDTO &state);
     void clearTextCaches();
@@ -54,5 +61,7 @@ public:
     ~GameView();
 
     void render(const GameStateDTO &state);
-    void renderDebugInfo(int fps, int msPerFrame);
+    // failure is the loading error, nullptr while the dictionary is still loading
+    void renderLoading(const char *failure = nullptr);
+    void renderDebugInfo(int fps, int msPerFrame, const DictionaryReloadStats &reloadStats);
 };
\ No newline at end of file
@@ -1,38 +1,9 @@
 #include "KeyboardDisplay.hpp"
-#include "UTF8Utils.hpp"
 #include "ViewUtils.hpp"
 #include <algorithm>
+#include <string>
 #include <vector>
 
-std::vector<std::string> createKeyboardRows(const std::string &alphabet)
-{
-    std::vector<std::string> allLetters = splitUtf8String(utf8ToUpper(alphabet));
-
-    std::vector<std::string> newRows;
-    const int NUM_ROWS = 3;
-    if (allLetters.empty())
-    {
-        return newRows;
-    }
-
-    size_t totalLetters = allLetters.size();
-    size_t lettersPerRow = (totalLetters + NUM_ROWS - 1) / NUM_ROWS;
-
-    size_t currentStart = 0;
-    for (int i = 0; i < NUM_ROWS && currentStart < totalLetters; ++i)
-    {
-        size_t rowLength = std::min(lettersPerRow, totalLetters - currentStart);
-        std::string rowString;
-        for (size_t j = 0; j < rowLength; ++j)
-        {
-            rowString += allLetters[currentStart + j];
-        }
-        newRows.push_back(rowString);
-        currentStart += rowLength;
-    }
-    return newRows;
-}
-
 KeyboardDisplay::KeyboardDisplay(SDL_Renderer *_renderer, TTF_TextEngine *_engine, const LayoutMetrics &metrics,
                                  const TTF_Font *_font, const GameStateDTO &state)
     : startX(metrics.keyboardCenterX), startY(metrics.keyboardStartY),
@@ -42,30 +13,27 @@ KeyboardDisplay::KeyboardDisplay(SDL_Renderer *_renderer, TTF_TextEngine *_engin
       engine(_engine), width(0.0F)
 {
     // STATE FILLING
-    keyRows = createKeyboardRows(state.currentAlphabet);
+    const int NUM_ROWS = 3;
+    const size_t lettersCount = state.getLettersCount();
+    const size_t lettersPerRow = (lettersCount + NUM_ROWS - 1) / NUM_ROWS;
+    keyBoxes.reserve(lettersCount);
+    keyStatuses.assign(lettersCount, CharStatus::UNKNOWN);
 
     float currentY = startY;
-    std::vector<std::string> rowByletters;
-
-    for (const auto &row : keyRows)
+    for (size_t rowStart = 0; rowStart < lettersCount; rowStart += lettersPerRow)
     {
-        rowByletters = splitUtf8String(row);
+        const size_t rowLength = std::min(lettersPerRow, lettersCount - rowStart);
 
-        if (rowByletters.empty())
-        {
-            continue;
-        }
-
-        float rowTotalWidth = (rowByletters.size() * keyWidth) + ((rowByletters.size() - 1) * keySpacing);
+        float rowTotalWidth = (rowLength * keyWidth) + ((rowLength - 1) * keySpacing);
         width = std::max(rowTotalWidth, width);
         float currentX = startX - (rowTotalWidth / 2.0f);
 
-        for (auto key : rowByletters)
+        for (size_t letter = rowStart; letter < rowStart + rowLength; ++letter)
         {
-            keyBoxes.emplace(key, CharBox(currentX, currentY, keyWidth, keyHeight,
-                                          key, CharStatus::UNKNOWN, font, renderer, engine));
-
-            keyStatuses[key] = CharStatus::UNKNOWN;
+            const auto key = static_cast<GameStateDTO::LetterId>(letter);
+            keyBoxes.emplace_back(currentX, currentY, keyWidth, keyHeight,
+                                  std::string(state.getUpperLetter(key)), CharStatus::UNKNOWN,
+                                  font, renderer, engine);
 
             currentX += keyWidth + keySpacing;
         }
@@ -73,40 +41,37 @@ KeyboardDisplay::KeyboardDisplay(SDL_Renderer *_renderer, TTF_TextEngine *_engin
     }
     height = currentY - startY + rowSpacing;
 
-    for (const auto &[key, status] : state.currentAlphabetStatus)
+    for (size_t letter = 0; letter < lettersCount; ++letter)
     {
-        updateStatus(key, toCharStatus(status));
+        c_cachedKeyStatuses[letter] = state.letterStatuses[letter];
+        updateStatus(static_cast<GameStateDTO::LetterId>(letter), toCharStatus(state.letterStatuses[letter]));
     }
 }
 
-void KeyboardDisplay::updateStatus(std::string key, CharStatus status)
+void KeyboardDisplay::updateStatus(GameStateDTO::LetterId key, CharStatus status)
 {
-    key = utf8ToUpper(key);
-    if (keyStatuses.contains(key))
+    if (key < keyStatuses.size() && status > keyStatuses[key])
     {
-        CharStatus currentStatus = keyStatuses[key];
-        if (status > currentStatus)
-        {
-            keyStatuses[key] = status;
-            keyBoxes.at(key).setStatus(status);
-        }
+        keyStatuses[key] = status;
+        keyBoxes[key].setStatus(status);
     }
 }
 
-void KeyboardDisplay::render(const std::map<std::string, GameStateDTO::LetterStatus> &newKeyStatuses)
+void KeyboardDisplay::render(std::span<const GameStateDTO::LetterStatus> newKeyStatuses)
 {
     // delta update
-    for (const auto &[key, newDTOStatus] : newKeyStatuses)
+    const size_t keysCount = std::min(newKeyStatuses.size(), keyBoxes.size());
+    for (size_t key = 0; key < keysCount; ++key)
     {
-        if (!c_cachedKeyStatuses.contains(key) || c_cachedKeyStatuses[key] != newDTOStatus)
+        if (c_cachedKeyStatuses[key] != newKeyStatuses[key])
         {
-            updateStatus(key, toCharStatus(newDTOStatus));
-            c_cachedKeyStatuses[key] = newDTOStatus;
+            updateStatus(static_cast<GameStateDTO::LetterId>(key), toCharStatus(newKeyStatuses[key]));
+            c_cachedKeyStatuses[key] = newKeyStatuses[key];
         }
     }
 
-    for (auto const &[key, box] : keyBoxes)
+    for (const auto &box : keyBoxes)
     {
         box.render();
     }
-}
\ No newline at end of file
+}
@@ -4,8 +4,8 @@
 #include "CharBox.hpp"
 #include "GameLayout.hpp"
 #include "SDL3_ttf/SDL_ttf.h"
-#include <map>
-#include <string>
+#include <array>
+#include <span>
 #include <vector>
 
 class KeyboardDisplay
@@ -21,19 +21,19 @@ private:
     TTF_TextEngine *engine;
 
     float width, height;
-    std::vector<std::string> keyRows;
 
-    std::map<std::string, CharBox> keyBoxes;
-    std::map<std::string, CharStatus> keyStatuses;
-    std::map<std::string, GameStateDTO::LetterStatus> c_cachedKeyStatuses;
+    // indexed by letter id, in the alphabet's keyboard order
+    std::vector<CharBox> keyBoxes;
+    std::vector<CharStatus> keyStatuses;
+    std::array<GameStateDTO::LetterStatus, GameStateDTO::MAX_LETTERS> c_cachedKeyStatuses{};
 
-    void updateStatus(std::string key, CharStatus status);
+    void updateStatus(GameStateDTO::LetterId key, CharStatus status);
 
 public:
     KeyboardDisplay(SDL_Renderer *renderer, TTF_TextEngine *engine, const LayoutMetrics &metrics,
                     const TTF_Font *font, const GameStateDTO &state);
 
-    void render(const std::map<std::string, GameStateDTO::LetterStatus> &newKeyStatuses);
+    void render(std::span<const GameStateDTO::LetterStatus> newKeyStatuses);
 
     float getWidth() const { return width; };
     float getHeight() const { return height; };
@@ -0,0 +1,117 @@
+#include "StatusLine.hpp"
+#include "UTF8Utils.hpp"
+#include <algorithm>
+#include <format>
+#include <string>
+#include <string_view>
+
+StatusLine::StatusLine(SDL_Renderer *_renderer, TTF_TextEngine *_engine, const LayoutMetrics &metrics, const TTF_Font *_font)
+    : renderer(_renderer), textEngine(_engine), font(_font),
+      centerX(metrics.keyboardCenterX), startY(metrics.statusLineY), height(metrics.statusLineHeight)
+{
+}
+
+StatusLine::~StatusLine()
+{
+    if (c_statusText != nullptr)
+    {
+        TTF_DestroyText(c_statusText);
+    }
+}
+
+std::string StatusLine::composeMessage(const GameStateDTO &state)
+{
+    if (state.errorMessage.empty() && !state.hint.word.empty())
+    {
+        std::string message = std::format("Подсказка: {} (в среднем останется {:.1f} сл.)", utf8ToUpper(std::string(state.hint.word)),
+                                          state.hint.expectedRemaining);
+        if (state.hint.searchProgress < 1.0)
+        {
+            message += std::format(", проверено {:.0f}%", state.hint.searchProgress * 100.0);
+        }
+        return message;
+    }
+
+    if (state.errorMessage.empty() && state.remainingCandidatesCount >= 0)
+    {
+        return std::format("{}Осталось слов: {}", state.isHardMode ? "Сложный режим. " : "", state.remainingCandidatesCount);
+    }
+
+    std::string message(state.errorMessage);
+    if (!state.suggestions.empty())
+    {
+        message += " Может быть: ";
+        for (size_t i = 0; i < state.suggestions.size(); ++i)
+        {
+            message += (i == 0 ? "" : ", ") + utf8ToUpper(std::string(state.suggestions[i]));
+        }
+        message += "?";
+    }
+    return message;
+}
+
+// compares without copying, the state keeps its messages in pmr strings
+bool StatusLine::isMessageChanged(const GameStateDTO &state) const
+{
+    return std::string_view(state.errorMessage) != c_cachedErrorMessage ||
+           !std::ranges::equal(state.suggestions, c_cachedSuggestions,
+                               [](std::string_view suggestion, std::string_view cached)
+                               { return suggestion == cached; }) ||
+           std::string_view(state.hint.word) != c_cachedHintWord ||
+           state.hint.expectedRemaining != c_cachedExpectedRemaining ||
+           state.hint.searchProgress != c_cachedSearchProgress ||
+           state.remainingCandidatesCount != c_cachedCandidatesCount ||
+           state.isHardMode != c_cachedIsHardMode;
+}
+
+void StatusLine::rememberMessageInputs(const GameStateDTO &state)
+{
+    c_cachedErrorMessage.assign(state.errorMessage);
+    c_cachedSuggestions.assign(state.suggestions.begin(), state.suggestions.end());
+    c_cachedHintWord.assign(state.hint.word);
+    c_cachedExpectedRemaining = state.hint.expectedRemaining;
+    c_cachedSearchProgress = state.hint.searchProgress;
+    c_cachedCandidatesCount = state.remainingCandidatesCount;
+    c_cachedIsHardMode = state.isHardMode;
+}
+
+void StatusLine::render(const GameStateDTO &state)
+{
+    const SDL_Color TEXT_COLOR = {255, 255, 255, 255};
+
+    if (textEngine == nullptr || font == nullptr)
+    {
+        return;
+    }
+
+    // the cache starts out matching a state with nothing to show
+    if (isMessageChanged(state))
+    {
+        rememberMessageInputs(state);
+        c_cachedMessage = composeMessage(state);
+        if (c_statusText != nullptr)
+        {
+            TTF_DestroyText(c_statusText);
+            c_statusText = nullptr;
+        }
+    }
+    if (c_cachedMessage.empty())
+    {
+        return;
+    }
+
+    if (c_statusText == nullptr)
+    {
+        c_statusText = TTF_CreateText(textEngine, const_cast<TTF_Font *>(font), c_cachedMessage.c_str(), 0);
+        if (c_statusText == nullptr)
+        {
+            return;
+        }
+        TTF_SetTextColor(c_statusText, TEXT_COLOR.r, TEXT_COLOR.g, TEXT_COLOR.b, TEXT_COLOR.a);
+    }
+
+    int textW = 0;
+    int textH = 0;
+    TTF_GetTextSize(c_statusText, &textW, &textH);
+    TTF_DrawRendererText(c_statusText, centerX - (textW / 2.0f), startY + ((height - textH) / 2.0f));
+}
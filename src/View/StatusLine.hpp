@@ -0,0 +1,49 @@
+#pragma once
+
+#include "SDL3/SDL_render.h"
+#include "SDL3_ttf/SDL_ttf.h"
+#include <string>
+#include <vector>
+
+#include "../Model/GameState.hpp"
+#include "GameLayout.hpp"
+
+// one line of text between the grid and the keyboard: why a guess was rejected
+// and which dictionary words were probably meant, otherwise the requested hint
+// or how many answers still fit the feedback
+class StatusLine
+{
+private:
+    SDL_Renderer *renderer;
+    TTF_TextEngine *textEngine;
+    const TTF_Font *font;
+    float centerX;
+    float startY;
+    float height;
+
+    // status cache, the message is composed again only when its inputs change
+    std::string c_cachedErrorMessage;
+    std::vector<std::string> c_cachedSuggestions;
+    std::string c_cachedHintWord;
+    double c_cachedExpectedRemaining = 0.0;
+    double c_cachedSearchProgress = 0.0;
+    int c_cachedCandidatesCount = -1;
+    bool c_cachedIsHardMode = false;
+    std::string c_cachedMessage;
+    TTF_Text *c_statusText = nullptr;
+
+    static std::string composeMessage(const GameStateDTO &state);
+
+    [[nodiscard]] bool isMessageChanged(const GameStateDTO &state) const;
+    void rememberMessageInputs(const GameStateDTO &state);
+
+public:
+    StatusLine(SDL_Renderer *_renderer, TTF_TextEngine *_engine, const LayoutMetrics &metrics, const TTF_Font *_font);
+    ~StatusLine();
+
+    void render(const GameStateDTO &state);
+
+    StatusLine(const StatusLine &other) = delete;
+
+    StatusLine &operator=(const StatusLine &other) = delete;
+};
@@ -36,7 +36,7 @@ void WordRow::setWord(const std::string &word, CharStatus defaultStatus)
     }
 }
 
-void WordRow::setStatuses(const std::string &word, const std::vector<CharStatus> &statuses)
+void WordRow::setStatuses(const std::string &word, std::span<const CharStatus> statuses)
 {
     if (statuses.size() != wordLength)
     {
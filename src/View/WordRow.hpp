@@ -2,6 +2,7 @@
 
 #include "CharBox.hpp"
 #include "SDL3_ttf/SDL_ttf.h"
+#include <span>
 #include <string>
 #include <vector>
 
@@ -25,7 +26,7 @@ public:
 
     void setWord(const std::string &word, CharStatus defaultStatus);
 
-    void setStatuses(const std::string &word, const std::vector<CharStatus> &statuses);
+    void setStatuses(const std::string &word, std::span<const CharStatus> statuses);
 
     void render();
 };
\ No newline at end of file
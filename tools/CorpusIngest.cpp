@@ -0,0 +1,523 @@
+// Builds per-length dictionaries and frequency lists from a large UTF-8 text corpus.
+// The corpus is streamed in chunks, chunks are tokenized on all cores and counted in sharded
+// hash maps. When the maps outgrow the memory budget, rare words are pruned (lossy counting),
+// so memory stays bounded for any corpus size.
+//
+// usage: CorpusIngest <corpus.txt> <ENGLISH|RUSSIAN> <output dir> [options]
+//   --min-length N   shortest word length to write (default 4)
+//   --max-length N   longest word length to write (default 12)
+//   --min-count N    drop words seen fewer than N times (default 1)
+//   --memory-mb N    budget for counters, chunks in flight and the workers' local counts (default 512)
+//   --threads N      worker threads (default: all cores, fewer if the budget cannot hold them)
+//
+// writes {LANG}_DICTIONARY_{N}L.txt (sorted words) and {LANG}_FREQUENCY_{N}L.txt ("word count"
+// lines, most frequent first) for every length that has words
+
+#include "../src/Model/Dictionary/Alphabet.hpp"
+#include "../src/Model/Dictionary/LetterCodec.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+static constexpr size_t CHUNK_SIZE = size_t{8} * 1024 * 1024;
+static constexpr size_t SHARDS_COUNT = 64;
+static constexpr size_t BYTES_PER_COUNTER = 48; // hash node, bucket pointer and allocator overhead
+static constexpr size_t LOCAL_COUNTS_LIMIT = size_t{1} << 16; // a worker's counts are merged once they reach it
+static constexpr size_t BYTES_PER_LOCAL_COUNT = BYTES_PER_COUNTER + 16; // local node plus its copy sorted by shard in merge
+
+struct IngestOptions
+{
+    std::filesystem::path corpusPath;
+    Alphabet::Language language = Alphabet::Language::RUSSIAN;
+    std::filesystem::path outputDir;
+    int minLength = 4;
+    int maxLength = 12;
+    std::uint64_t minCount = 1;
+    size_t memoryBudget = size_t{512} * 1024 * 1024;
+    unsigned threadsCount = std::max(1U, std::thread::hardware_concurrency());
+};
+
+// Hands chunks from the reader to the workers, blocks the reader while the queue is full.
+class ChunkQueue
+{
+private:
+    std::mutex queueMutex;
+    std::condition_variable queueChanged;
+    std::queue<std::vector<char>> chunks;
+    size_t capacity;
+    bool isClosed = false;
+
+public:
+    explicit ChunkQueue(size_t _capacity) : capacity(_capacity) {}
+
+    void push(std::vector<char> chunk)
+    {
+        std::unique_lock lock(queueMutex);
+        queueChanged.wait(lock, [this]
+                          { return chunks.size() < capacity; });
+        chunks.push(std::move(chunk));
+        queueChanged.notify_all();
+    }
+
+    // empty once the queue is closed and drained
+    std::optional<std::vector<char>> pop()
+    {
+        std::unique_lock lock(queueMutex);
+        queueChanged.wait(lock, [this]
+                          { return !chunks.empty() || isClosed; });
+        if (chunks.empty())
+        {
+            return std::nullopt;
+        }
+        std::vector<char> chunk = std::move(chunks.front());
+        chunks.pop();
+        queueChanged.notify_all();
+        return chunk;
+    }
+
+    void close()
+    {
+        std::lock_guard lock(queueMutex);
+        isClosed = true;
+        queueChanged.notify_all();
+    }
+};
+
+// Word counters split by key into independently locked shards. Keys are words packed by LetterCodec.
+class ShardedCounter
+{
+private:
+    struct Shard
+    {
+        std::mutex shardMutex;
+        std::unordered_map<std::uint64_t, std::uint64_t> counts;
+    };
+
+    std::vector<Shard> shards;
+    size_t maxEntries;
+    std::atomic<size_t> entriesCount = 0;
+
+    std::mutex pruneMutex;
+    std::atomic<std::uint64_t> pruneThreshold = 0;
+    std::atomic<int> prunesCount = 0;
+
+    static size_t shardOf(std::uint64_t key)
+    {
+        return (key * 0x9E3779B97F4A7C15ULL) >> 58; // top 6 bits, SHARDS_COUNT == 64
+    }
+
+    void prune()
+    {
+        std::unique_lock pruneLock(pruneMutex, std::try_to_lock);
+        if (!pruneLock.owns_lock() || entriesCount.load() <= maxEntries)
+        {
+            return;
+        }
+
+        // every pass doubles the threshold, until the maps are back at half of the budget
+        do
+        {
+            const std::uint64_t threshold = std::max<std::uint64_t>(1, pruneThreshold.load() * 2);
+            for (Shard &shard : shards)
+            {
+                std::lock_guard lock(shard.shardMutex);
+                const size_t sizeBefore = shard.counts.size();
+                std::erase_if(shard.counts, [threshold](const auto &entry)
+                              { return entry.second <= threshold; });
+                entriesCount -= sizeBefore - shard.counts.size();
+            }
+            pruneThreshold = threshold;
+            prunesCount++;
+        } while (entriesCount.load() > maxEntries / 2);
+    }
+
+public:
+    explicit ShardedCounter(size_t _maxEntries) : shards(SHARDS_COUNT), maxEntries(_maxEntries) {}
+
+    void merge(const std::unordered_map<std::uint64_t, std::uint64_t> &localCounts)
+    {
+        std::array<std::vector<std::pair<std::uint64_t, std::uint64_t>>, SHARDS_COUNT> byShard;
+        for (const auto &entry : localCounts)
+        {
+            byShard[shardOf(entry.first)].push_back(entry);
+        }
+
+        for (size_t shardIndex = 0; shardIndex < SHARDS_COUNT; ++shardIndex)
+        {
+            if (byShard[shardIndex].empty())
+            {
+                continue;
+            }
+            Shard &shard = shards[shardIndex];
+            std::lock_guard lock(shard.shardMutex);
+            const size_t sizeBefore = shard.counts.size();
+            for (const auto &[key, count] : byShard[shardIndex])
+            {
+                shard.counts[key] += count;
+            }
+            entriesCount += shard.counts.size() - sizeBefore;
+        }
+
+        if (entriesCount.load() > maxEntries)
+        {
+            prune();
+        }
+    }
+
+    // words seen at most this many times may be missing from the result
+    std::uint64_t getPruneThreshold() const { return pruneThreshold.load(); }
+
+    int getPrunesCount() const { return prunesCount.load(); }
+
+    // call after all workers finished
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> takeAll()
+    {
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> allCounts;
+        allCounts.reserve(entriesCount.load());
+        for (Shard &shard : shards)
+        {
+            allCounts.insert(allCounts.end(), shard.counts.begin(), shard.counts.end());
+            shard.counts.clear();
+        }
+        return allCounts;
+    }
+};
+
+static char32_t toLowerLetter(char32_t codepoint)
+{
+    if ((codepoint >= U'A' && codepoint <= U'Z') || (codepoint >= U'А' && codepoint <= U'Я'))
+    {
+        return codepoint + 0x20;
+    }
+    if (codepoint == U'Ё')
+    {
+        return U'ё';
+    }
+    return codepoint;
+}
+
+// whitespace, punctuation and digits end a token, any other character belongs to it
+static bool isSeparator(char32_t codepoint)
+{
+    if (codepoint < 0x80)
+    {
+        const bool isAsciiLetter = (codepoint >= U'a' && codepoint <= U'z') || (codepoint >= U'A' && codepoint <= U'Z');
+        return !isAsciiLetter;
+    }
+    return codepoint <= 0xBF ||                           // latin-1 controls and punctuation
+           (codepoint >= 0x2000 && codepoint <= 0x206F) || // general punctuation
+           codepoint == 0xFEFF;                           // byte order mark
+}
+
+// counts alphabet-only tokens of allowed length in one chunk, merging into counter whenever
+// localCounts reaches LOCAL_COUNTS_LIMIT and at the end, so a worker's own map stays bounded
+static void countChunk(std::string_view text, const LetterCodec &letterCodec, const IngestOptions &options,
+                       std::unordered_map<std::uint64_t, std::uint64_t> &localCounts, ShardedCounter &counter)
+{
+    std::string token;
+    int tokenLength = 0;
+    bool isTokenValid = true;
+
+    auto finishToken = [&]()
+    {
+        if (tokenLength >= options.minLength && tokenLength <= options.maxLength && isTokenValid)
+        {
+            localCounts[letterCodec.packWord(token)]++;
+            if (localCounts.size() >= LOCAL_COUNTS_LIMIT)
+            {
+                counter.merge(localCounts);
+                localCounts.clear();
+            }
+        }
+        token.clear();
+        tokenLength = 0;
+        isTokenValid = true;
+    };
+
+    size_t position = 0;
+    while (position < text.size())
+    {
+        const char32_t codepoint = toLowerLetter(LetterCodec::decodeUtf8(text, position));
+        if (isSeparator(codepoint))
+        {
+            finishToken();
+            continue;
+        }
+
+        tokenLength++;
+        if (letterCodec.getLetterIndex(codepoint) == LetterCodec::INVALID_LETTER || tokenLength > options.maxLength)
+        {
+            isTokenValid = false;
+        }
+        else
+        {
+            LetterCodec::appendUtf8(token, codepoint);
+        }
+    }
+    finishToken();
+    counter.merge(localCounts);
+    localCounts.clear();
+}
+
+// cuts the chunk after its last whitespace, so no token is split between two chunks
+static size_t findChunkEnd(const std::vector<char> &chunk)
+{
+    for (size_t position = chunk.size(); position > 0; --position)
+    {
+        const char byte = chunk[position - 1];
+        if (byte == '\n' || byte == ' ' || byte == '\t' || byte == '\r')
+        {
+            return position;
+        }
+    }
+    // one huge token, cut at a character boundary instead
+    size_t position = chunk.size();
+    while (position > 0 && (static_cast<unsigned char>(chunk[position - 1]) & 0xC0) == 0x80)
+    {
+        position--;
+    }
+    return position > 0 ? position - 1 : chunk.size();
+}
+
+static void writeDictionaries(std::vector<std::pair<std::uint64_t, std::uint64_t>> allCounts,
+                              const LetterCodec &letterCodec, const IngestOptions &options)
+{
+    std::map<int, std::vector<std::pair<std::string, std::uint64_t>>> wordsByLength;
+    for (const auto &[key, count] : allCounts)
+    {
+        if (count < options.minCount)
+        {
+            continue;
+        }
+        std::string word = letterCodec.unpackWord(key);
+        size_t wordLength = 0;
+        for (size_t position = 0; position < word.size(); ++wordLength)
+        {
+            LetterCodec::decodeUtf8(word, position);
+        }
+        wordsByLength[static_cast<int>(wordLength)].emplace_back(std::move(word), count);
+    }
+
+    const std::string languageString = Alphabet::getLanguageString(options.language);
+    std::filesystem::create_directories(options.outputDir);
+
+    for (auto &[wordLength, words] : wordsByLength)
+    {
+        std::ranges::sort(words, [](const auto &lhs, const auto &rhs)
+                          { return lhs.first < rhs.first; });
+
+        const auto dictionaryPath = options.outputDir / std::format("{}_DICTIONARY_{}L.txt", languageString, wordLength);
+        std::ofstream dictionaryFile(dictionaryPath, std::ios::binary | std::ios::trunc);
+        for (const auto &[word, count] : words)
+        {
+            dictionaryFile << word << '\n';
+        }
+
+        std::ranges::stable_sort(words, [](const auto &lhs, const auto &rhs)
+                                 { return lhs.second > rhs.second; });
+
+        const auto frequencyPath = options.outputDir / std::format("{}_FREQUENCY_{}L.txt", languageString, wordLength);
+        std::ofstream frequencyFile(frequencyPath, std::ios::binary | std::ios::trunc);
+        for (const auto &[word, count] : words)
+        {
+            frequencyFile << word << ' ' << count << '\n';
+        }
+
+        if (!dictionaryFile || !frequencyFile)
+        {
+            throw std::runtime_error("cannot write " + dictionaryPath.string());
+        }
+        std::cout << std::format("{}: {} words\n", dictionaryPath.filename().string(), words.size());
+    }
+}
+
+static void ingest(const IngestOptions &options)
+{
+    const LetterCodec letterCodec(options.language);
+    if (options.minLength < 1 || options.maxLength > letterCodec.getMaxPackedLength() || options.minLength > options.maxLength)
+    {
+        throw std::runtime_error(std::format("word lengths must be within 1..{}", letterCodec.getMaxPackedLength()));
+    }
+
+    std::ifstream corpusFile(options.corpusPath, std::ios::binary);
+    if (!corpusFile.is_open())
+    {
+        throw std::runtime_error("cannot open " + options.corpusPath.string());
+    }
+
+    // a worker holds up to two chunks (queued and being counted) and its local counts; the reader
+    // holds the chunk it fills and the carry. Workers get at most half of the budget, the shared
+    // counters the rest, so the thread count is clamped for small budgets or many cores
+    const size_t workerBudget = (CHUNK_SIZE * 2) + (LOCAL_COUNTS_LIMIT * BYTES_PER_LOCAL_COUNT);
+    const size_t readerBudget = CHUNK_SIZE * 2;
+    if (options.memoryBudget / 2 < readerBudget + workerBudget)
+    {
+        throw std::runtime_error(std::format("memory budget must be at least {} MB",
+                                             ((readerBudget + workerBudget) * 2) / (1024 * 1024) + 1));
+    }
+    const auto threadsCount = static_cast<unsigned>(std::min<size_t>((options.memoryBudget / 2 - readerBudget) / workerBudget,
+                                                                     options.threadsCount));
+    if (threadsCount < options.threadsCount)
+    {
+        std::cout << std::format("{} threads fit the memory budget, {} requested\n", threadsCount, options.threadsCount);
+    }
+    const size_t inFlightBudget = readerBudget + (workerBudget * threadsCount);
+
+    ShardedCounter counter((options.memoryBudget - inFlightBudget) / BYTES_PER_COUNTER);
+    ChunkQueue queue(threadsCount);
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::jthread> workers;
+    for (unsigned i = 0; i < threadsCount; ++i)
+    {
+        workers.emplace_back([&]()
+                             {
+            std::unordered_map<std::uint64_t, std::uint64_t> localCounts;
+            localCounts.reserve(LOCAL_COUNTS_LIMIT);
+            while (auto chunk = queue.pop())
+            {
+                countChunk(std::string_view(chunk->data(), chunk->size()), letterCodec, options, localCounts, counter);
+            } });
+    }
+
+    std::uint64_t bytesRead = 0;
+    std::vector<char> carry;
+    while (corpusFile)
+    {
+        std::vector<char> chunk = std::move(carry);
+        carry.clear();
+        const size_t carrySize = chunk.size();
+        chunk.resize(carrySize + CHUNK_SIZE);
+        corpusFile.read(chunk.data() + carrySize, static_cast<std::streamsize>(CHUNK_SIZE));
+        chunk.resize(carrySize + static_cast<size_t>(corpusFile.gcount()));
+        bytesRead += static_cast<std::uint64_t>(corpusFile.gcount());
+
+        if (corpusFile)
+        {
+            const size_t chunkEnd = findChunkEnd(chunk);
+            carry.assign(chunk.begin() + static_cast<std::ptrdiff_t>(chunkEnd), chunk.end());
+            chunk.resize(chunkEnd);
+        }
+        if (!chunk.empty())
+        {
+            queue.push(std::move(chunk));
+        }
+    }
+    queue.close();
+    workers.clear();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::cout << std::format("read {:.1f} MB in {:.2f} s, {:.1f} MB/s on {} threads\n",
+                             bytesRead / (1024.0 * 1024.0), seconds,
+                             bytesRead / (1024.0 * 1024.0) / std::max(seconds, 1e-9), threadsCount);
+    if (counter.getPrunesCount() > 0)
+    {
+        std::cout << std::format("memory budget reached {} times, words seen up to {} times may be missing\n",
+                                 counter.getPrunesCount(), counter.getPruneThreshold());
+    }
+
+    writeDictionaries(counter.takeAll(), letterCodec, options);
+}
+
+static IngestOptions parseOptions(int argc, char *argv[])
+{
+    if (argc < 4 || (argc % 2) != 0)
+    {
+        throw std::invalid_argument("wrong number of arguments");
+    }
+
+    IngestOptions options;
+    options.corpusPath = argv[1];
+    const std::string languageString = argv[2];
+    if (languageString == Alphabet::getLanguageString(Alphabet::Language::ENGLISH))
+    {
+        options.language = Alphabet::Language::ENGLISH;
+    }
+    else if (languageString == Alphabet::getLanguageString(Alphabet::Language::RUSSIAN))
+    {
+        options.language = Alphabet::Language::RUSSIAN;
+    }
+    else
+    {
+        throw std::invalid_argument("unknown language " + languageString);
+    }
+    options.outputDir = argv[3];
+
+    for (int i = 4; i < argc; i += 2)
+    {
+        const std::string option = argv[i];
+        const unsigned long long value = std::stoull(argv[i + 1]);
+        if (option == "--min-length")
+        {
+            options.minLength = static_cast<int>(value);
+        }
+        else if (option == "--max-length")
+        {
+            options.maxLength = static_cast<int>(value);
+        }
+        else if (option == "--min-count")
+        {
+            options.minCount = value;
+        }
+        else if (option == "--memory-mb")
+        {
+            options.memoryBudget = static_cast<size_t>(value) * 1024 * 1024;
+        }
+        else if (option == "--threads")
+        {
+            options.threadsCount = std::max(1U, static_cast<unsigned>(value));
+        }
+        else
+        {
+            throw std::invalid_argument("unknown option " + option);
+        }
+    }
+    return options;
+}
+
+int main(int argc, char *argv[])
+{
+    IngestOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "CorpusIngest: " << e.what() << "\n"
+                  << "usage: CorpusIngest <corpus.txt> <ENGLISH|RUSSIAN> <output dir> [--min-length N] [--max-length N]\n"
+                  << "                    [--min-count N] [--memory-mb N] [--threads N]\n";
+        return 1;
+    }
+
+    try
+    {
+        ingest(options);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "CorpusIngest: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
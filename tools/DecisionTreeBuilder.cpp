@@ -0,0 +1,427 @@
+// Builds the hint strategy tree of one dictionary: starting from a fixed opener, the guess for
+// every feedback path until each answer is found. Every node takes the guess with the highest
+// entropy over the answers still possible there (greedy, not a minimum-expected-guesses search).
+// Subtrees below the opener are built in parallel, the pattern matrix is shared with the game
+// through its cache.
+//
+// usage: DecisionTreeBuilder <dictionaries dir> <ENGLISH|RUSSIAN> <word length> <output.bin> [options]
+//   --opener WORD   first guess (default: the highest entropy word)
+//   --threads N     worker threads (default: all cores)
+//
+// reports the average and the worst number of guesses over all answers
+
+#include "../src/Model/Dictionary/Alphabet.hpp"
+#include "../src/Model/Dictionary/WordIndex.hpp"
+#include "../src/Model/Solver/DecisionTree.hpp"
+#include "../src/Model/Solver/FeedbackScorer.hpp"
+#include "../src/Model/Solver/PatternMatrix.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+static constexpr size_t PATTERNS_COUNT = 256;
+static constexpr int MAX_ATTEMPTS = 6;
+
+struct BuildOptions
+{
+    std::filesystem::path dictionariesDir;
+    Alphabet::Language language = Alphabet::Language::RUSSIAN;
+    int wordLength = 5;
+    std::filesystem::path outputPath;
+    std::string opener;
+    unsigned threadsCount = std::max(1U, std::thread::hardware_concurrency());
+};
+
+struct TreeNode
+{
+    std::uint32_t guessNumber = 0;
+    float expectedRemaining = 0.0F;
+    std::vector<std::pair<std::uint32_t, std::unique_ptr<TreeNode>>> children; // by pattern code
+};
+
+struct GuessStats
+{
+    size_t answersCount = 0;
+    size_t guessesSum = 0;
+    int worstGuesses = 0;
+    size_t overLimitCount = 0; // answers needing more than MAX_ATTEMPTS guesses
+
+    void add(int guesses, size_t answers)
+    {
+        answersCount += answers;
+        guessesSum += static_cast<size_t>(guesses) * answers;
+        worstGuesses = std::max(worstGuesses, guesses);
+        overLimitCount += guesses > MAX_ATTEMPTS ? answers : 0;
+    }
+
+    void merge(const GuessStats &other)
+    {
+        answersCount += other.answersCount;
+        guessesSum += other.guessesSum;
+        worstGuesses = std::max(worstGuesses, other.worstGuesses);
+        overLimitCount += other.overLimitCount;
+    }
+};
+
+// greedy strategy over one pattern matrix, one instance per worker thread
+class TreeBuilder
+{
+private:
+    const PatternMatrix &matrix;
+    std::uint32_t solvedCode;
+    std::vector<double> bucketWeights; // c * log2(c)
+    std::array<std::uint32_t, PATTERNS_COUNT> bucketSizes{};
+    std::vector<std::uint8_t> touchedBuckets;
+
+    // entropy of the split of candidates by the guess, and the expected size of a part
+    std::pair<double, double> rateGuess(size_t guessNumber, std::span<const std::uint32_t> candidates)
+    {
+        const auto patterns = matrix.getRow(guessNumber);
+        touchedBuckets.clear();
+        for (std::uint32_t candidate : candidates)
+        {
+            if (bucketSizes[patterns[candidate]]++ == 0)
+            {
+                touchedBuckets.push_back(patterns[candidate]);
+            }
+        }
+
+        double weightSum = 0.0;
+        double squaredSum = 0.0;
+        for (std::uint8_t bucket : touchedBuckets)
+        {
+            weightSum += bucketWeights[bucketSizes[bucket]];
+            squaredSum += static_cast<double>(bucketSizes[bucket]) * bucketSizes[bucket];
+            bucketSizes[bucket] = 0;
+        }
+        const auto candidatesCount = static_cast<double>(candidates.size());
+        return {std::log2(candidatesCount) - (weightSum / candidatesCount), squaredSum / candidatesCount};
+    }
+
+public:
+    explicit TreeBuilder(const PatternMatrix &_matrix)
+        : matrix(_matrix), solvedCode(FeedbackScorer::allCorrect(_matrix.getWordLength())),
+          bucketWeights(_matrix.getWordsCount() + 1, 0.0)
+    {
+        for (size_t size = 2; size < bucketWeights.size(); ++size)
+        {
+            bucketWeights[size] = static_cast<double>(size) * std::log2(static_cast<double>(size));
+        }
+    }
+
+    // candidates are tried first, one that splits all answers apart cannot be beaten
+    std::pair<std::uint32_t, double> chooseGuess(std::span<const std::uint32_t> candidates)
+    {
+        const double perfectSplit = std::log2(static_cast<double>(std::min<size_t>(candidates.size(), PATTERNS_COUNT)));
+        std::uint32_t bestGuess = candidates[0];
+        auto [bestEntropy, bestRemaining] = rateGuess(bestGuess, candidates);
+
+        for (std::uint32_t candidate : candidates.subspan(1))
+        {
+            if (bestEntropy >= perfectSplit)
+            {
+                return {bestGuess, bestRemaining};
+            }
+            const auto [entropy, remaining] = rateGuess(candidate, candidates);
+            if (entropy > bestEntropy)
+            {
+                bestGuess = candidate;
+                bestEntropy = entropy;
+                bestRemaining = remaining;
+            }
+        }
+        if (bestEntropy >= perfectSplit)
+        {
+            return {bestGuess, bestRemaining};
+        }
+
+        // candidates are sorted, they were rated above
+        for (std::uint32_t guess = 0; guess < matrix.getWordsCount(); ++guess)
+        {
+            if (std::ranges::binary_search(candidates, guess))
+            {
+                continue;
+            }
+            const auto [entropy, remaining] = rateGuess(guess, candidates);
+            if (entropy > bestEntropy)
+            {
+                bestGuess = guess;
+                bestEntropy = entropy;
+                bestRemaining = remaining;
+            }
+        }
+        return {bestGuess, bestRemaining};
+    }
+
+    // answers split by the guess's feedback, in increasing pattern code
+    std::vector<std::pair<std::uint32_t, std::vector<std::uint32_t>>> split(std::uint32_t guess,
+                                                                            std::span<const std::uint32_t> candidates) const
+    {
+        const auto patterns = matrix.getRow(guess);
+        std::array<std::vector<std::uint32_t>, PATTERNS_COUNT> parts;
+        for (std::uint32_t candidate : candidates)
+        {
+            parts[patterns[candidate]].push_back(candidate);
+        }
+
+        std::vector<std::pair<std::uint32_t, std::vector<std::uint32_t>>> result;
+        for (std::uint32_t code = 0; code < PATTERNS_COUNT; ++code)
+        {
+            if (!parts[code].empty())
+            {
+                result.emplace_back(code, std::move(parts[code]));
+            }
+        }
+        return result;
+    }
+
+    std::unique_ptr<TreeNode> build(std::span<const std::uint32_t> candidates, std::uint32_t guess, double expectedRemaining,
+                                    int depth, GuessStats &stats)
+    {
+        auto node = std::make_unique<TreeNode>();
+        node->guessNumber = guess;
+        node->expectedRemaining = static_cast<float>(expectedRemaining);
+
+        for (auto &[code, part] : split(guess, candidates))
+        {
+            if (code == solvedCode)
+            {
+                stats.add(depth + 1, part.size());
+                continue;
+            }
+            const auto [childGuess, childRemaining] = chooseGuess(part);
+            node->children.emplace_back(code, build(part, childGuess, childRemaining, depth + 1, stats));
+        }
+        return node;
+    }
+};
+
+static BuildOptions parseOptions(int argc, char *argv[])
+{
+    if (argc < 5 || (argc % 2) == 0)
+    {
+        throw std::invalid_argument("wrong number of arguments");
+    }
+
+    BuildOptions options;
+    options.dictionariesDir = argv[1];
+    const std::string languageString = argv[2];
+    if (languageString == Alphabet::getLanguageString(Alphabet::Language::ENGLISH))
+    {
+        options.language = Alphabet::Language::ENGLISH;
+    }
+    else if (languageString == Alphabet::getLanguageString(Alphabet::Language::RUSSIAN))
+    {
+        options.language = Alphabet::Language::RUSSIAN;
+    }
+    else
+    {
+        throw std::invalid_argument("unknown language " + languageString);
+    }
+    options.wordLength = std::stoi(argv[3]);
+    options.outputPath = argv[4];
+
+    for (int i = 5; i < argc; i += 2)
+    {
+        const std::string option = argv[i];
+        if (option == "--opener")
+        {
+            options.opener = argv[i + 1];
+        }
+        else if (option == "--threads")
+        {
+            options.threadsCount = std::max(1U, static_cast<unsigned>(std::stoul(argv[i + 1])));
+        }
+        else
+        {
+            throw std::invalid_argument("unknown option " + option);
+        }
+    }
+    return options;
+}
+
+static std::uint32_t findWordNumber(const WordIndex &index, const std::string &word)
+{
+    const size_t wordsCount = index.getWordLetters().size() / index.getWordLength();
+    for (size_t wordNumber = 0; wordNumber < wordsCount; ++wordNumber)
+    {
+        if (index.getWord(index.getLettersWordNumber(wordNumber)) == word)
+        {
+            return static_cast<std::uint32_t>(wordNumber);
+        }
+    }
+    throw std::invalid_argument("opener " + word + " is not in the dictionary");
+}
+
+// nodes in breadth-first order, so every child comes after its parent
+static void writeTree(const TreeNode &root, const WordIndex &index, std::uint64_t contentHash, const std::filesystem::path &outputPath)
+{
+    std::vector<DecisionTreeNode> nodes;
+    std::vector<DecisionTreeEdge> edges;
+    std::queue<const TreeNode *> pending;
+    pending.push(&root);
+    size_t assignedCount = 1;
+
+    while (!pending.empty())
+    {
+        const TreeNode *node = pending.front();
+        pending.pop();
+
+        nodes.push_back({node->guessNumber, static_cast<std::uint32_t>(edges.size()),
+                         static_cast<std::uint32_t>(node->children.size()), node->expectedRemaining});
+        for (const auto &[code, child] : node->children)
+        {
+            edges.push_back({code, static_cast<std::uint32_t>(assignedCount++)});
+            pending.push(child.get());
+        }
+    }
+
+    DecisionTreeHeader header{};
+    header.magic = DecisionTreeHeader::MAGIC;
+    header.version = DecisionTreeHeader::VERSION;
+    header.wordLength = static_cast<std::uint32_t>(index.getWordLength());
+    header.nodesCount = static_cast<std::uint32_t>(nodes.size());
+    header.edgesCount = static_cast<std::uint32_t>(edges.size());
+    header.wordsCount = static_cast<std::uint32_t>(index.getWordLetters().size() / index.getWordLength());
+    header.answersCount = static_cast<std::uint32_t>(index.getAnswerBlocks().size());
+    header.contentHash = contentHash;
+    header.answersHash = DecisionTree::hashAnswers(index.getAnswerBlocks());
+
+    if (outputPath.has_parent_path())
+    {
+        std::filesystem::create_directories(outputPath.parent_path());
+    }
+    std::ofstream outputFile(outputPath, std::ios::binary | std::ios::trunc);
+    outputFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    outputFile.write(reinterpret_cast<const char *>(nodes.data()), static_cast<std::streamsize>(nodes.size() * sizeof(DecisionTreeNode)));
+    outputFile.write(reinterpret_cast<const char *>(edges.data()), static_cast<std::streamsize>(edges.size() * sizeof(DecisionTreeEdge)));
+    if (!outputFile)
+    {
+        throw std::runtime_error("cannot write " + outputPath.string());
+    }
+    std::cout << std::format("{} nodes, {} edges, {} bytes\n", nodes.size(), edges.size(),
+                             sizeof(header) + (nodes.size() * sizeof(DecisionTreeNode)) + (edges.size() * sizeof(DecisionTreeEdge)));
+}
+
+static void buildTree(const BuildOptions &options)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    const std::string pathPrefix = Alphabet::getLanguageString(options.language);
+    const WordListPaths paths{options.dictionariesDir / (pathPrefix + std::format("_DICTIONARY_{}L.txt", options.wordLength)),
+                              options.dictionariesDir / (pathPrefix + std::format("_ANSWERS_{}L.txt", options.wordLength)),
+                              options.dictionariesDir / (pathPrefix + std::format("_FREQUENCY_{}L.txt", options.wordLength))};
+    const WordIndex index(paths, options.language, options.wordLength);
+    const auto matrix = PatternMatrix::loadOrBuild(index, options.language);
+    const std::vector<std::uint32_t> answers(index.getAnswerBlocks().begin(), index.getAnswerBlocks().end());
+    if (answers.empty())
+    {
+        throw std::runtime_error("no answers of the requested length");
+    }
+
+    TreeBuilder rootBuilder(*matrix);
+    auto [opener, openerRemaining] = rootBuilder.chooseGuess(answers);
+    if (!options.opener.empty())
+    {
+        opener = findWordNumber(index, options.opener);
+    }
+
+    TreeNode root;
+    root.guessNumber = opener;
+    GuessStats stats;
+    std::vector<std::pair<std::uint32_t, std::vector<std::uint32_t>>> parts;
+    for (auto &[code, part] : rootBuilder.split(opener, answers))
+    {
+        if (code == FeedbackScorer::allCorrect(options.wordLength))
+        {
+            stats.add(1, part.size());
+        }
+        else
+        {
+            parts.emplace_back(code, std::move(part));
+        }
+    }
+
+    double squaredSum = 0.0;
+    for (const auto &[code, part] : parts)
+    {
+        squaredSum += static_cast<double>(part.size()) * part.size();
+    }
+    root.expectedRemaining = static_cast<float>((squaredSum + stats.answersCount) / answers.size());
+
+    // every part below the opener is an independent subtree
+    root.children.resize(parts.size());
+    std::vector<GuessStats> workerStats(options.threadsCount);
+    std::atomic<size_t> nextPart = 0;
+    auto buildParts = [&](unsigned workerNumber)
+    {
+        TreeBuilder builder(*matrix);
+        for (size_t part = nextPart.fetch_add(1); part < parts.size(); part = nextPart.fetch_add(1))
+        {
+            const auto [guess, remaining] = builder.chooseGuess(parts[part].second);
+            root.children[part] = {parts[part].first, builder.build(parts[part].second, guess, remaining, 1, workerStats[workerNumber])};
+        }
+    };
+    {
+        std::vector<std::jthread> workers;
+        for (unsigned workerNumber = 1; workerNumber < options.threadsCount; ++workerNumber)
+        {
+            workers.emplace_back(buildParts, workerNumber);
+        }
+        buildParts(0);
+    }
+    for (const GuessStats &workerStat : workerStats)
+    {
+        stats.merge(workerStat);
+    }
+
+    writeTree(root, index, matrix->getContentHash(), options.outputPath);
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::cout << std::format("opener {}, {} answers: {:.3f} guesses on average, {} at worst, {} over {} guesses ({:.2f} s)\n",
+                             index.getWord(index.getLettersWordNumber(opener)), stats.answersCount,
+                             static_cast<double>(stats.guessesSum) / static_cast<double>(stats.answersCount),
+                             stats.worstGuesses, stats.overLimitCount, MAX_ATTEMPTS, seconds);
+}
+
+int main(int argc, char *argv[])
+{
+    BuildOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "DecisionTreeBuilder: " << e.what() << "\n"
+                  << "usage: DecisionTreeBuilder <dictionaries dir> <ENGLISH|RUSSIAN> <word length> <output.bin>\n"
+                  << "                           [--opener WORD] [--threads N]\n";
+        return 1;
+    }
+
+    try
+    {
+        buildTree(options);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "DecisionTreeBuilder: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,198 @@
+// Times dictionary lookups on word lists of growing size. A lookup hashes the word and probes the
+// index a bounded number of times whatever the size; what grows is the cache misses once the index
+// no longer fits in the caches.
+// Every list is random 6-letter English words written to a temporary directory and loaded by
+// Dictionary as the game loads its own. Half of the queries are words of the list, half are random
+// words that are almost never in it; isValidWord takes them one by one, areValidWords in batches.
+//
+// usage: DictionaryBenchmark [max words count] [queries count]
+//   max words count  size of the largest list, lists grow tenfold from 1000 (default 1000000)
+//   queries count    lookups per measurement (default 1000000)
+//
+// prints the load time, memory and time per lookup of every list size
+
+#include "../src/Model/Dictionary/Dictionary.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static constexpr int WORD_LENGTH = 6;
+static constexpr size_t MIN_WORDS_COUNT = 1000;
+static constexpr size_t BATCH_SIZE = 64;
+
+struct BenchmarkOptions
+{
+    size_t maxWordsCount = 1000000;
+    size_t queriesCount = 1000000;
+};
+
+static BenchmarkOptions parseOptions(int argc, char *argv[])
+{
+    BenchmarkOptions options;
+    if (argc > 3)
+    {
+        throw std::invalid_argument("too many arguments");
+    }
+    if (argc > 1)
+    {
+        options.maxWordsCount = std::stoul(argv[1]);
+    }
+    if (argc > 2)
+    {
+        options.queriesCount = std::stoul(argv[2]);
+    }
+    if (options.maxWordsCount < MIN_WORDS_COUNT || options.queriesCount == 0)
+    {
+        throw std::invalid_argument(std::format("max words count must be at least {} and queries count positive",
+                                                MIN_WORDS_COUNT));
+    }
+    return options;
+}
+
+static std::string makeWord(std::mt19937 &random)
+{
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::string word(WORD_LENGTH, ' ');
+    for (char &wordLetter : word)
+    {
+        wordLetter = static_cast<char>(letter(random));
+    }
+    return word;
+}
+
+// the list file of a dictionary with this many words, without answers and frequency files
+static WordListPaths writeWordList(const std::filesystem::path &directory, const std::vector<std::string> &words)
+{
+    WordListPaths paths{directory / std::format("ENGLISH_DICTIONARY_{}.txt", words.size()), {}, {}};
+    std::ofstream listFile(paths.allowed, std::ios::binary);
+    for (const std::string &word : words)
+    {
+        listFile << word << '\n';
+    }
+    if (!listFile)
+    {
+        throw std::runtime_error(std::format("cannot write {}", paths.allowed.string()));
+    }
+    return paths;
+}
+
+// nanoseconds per query of lookUp, which runs over all queries and returns the number found
+template <typename LookUp>
+static double measure(const LookUp &lookUp, size_t queriesCount, size_t &foundCount)
+{
+    foundCount = lookUp(); // warms the caches
+    const auto startTime = std::chrono::steady_clock::now();
+    foundCount = lookUp();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return seconds * 1e9 / static_cast<double>(queriesCount);
+}
+
+static void benchmarkSize(const std::filesystem::path &directory, const std::vector<std::string> &allWords,
+                          size_t wordsCount, size_t queriesCount)
+{
+    const std::vector<std::string> words(allWords.begin(), allWords.begin() + static_cast<std::ptrdiff_t>(wordsCount));
+    const WordListPaths paths = writeWordList(directory, words);
+
+    const auto loadStart = std::chrono::steady_clock::now();
+    Dictionary dictionary(paths, Alphabet::Language::ENGLISH, WORD_LENGTH);
+    const double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+
+    // even queries are words of the list, odd ones random words
+    std::mt19937 random(static_cast<std::uint32_t>(wordsCount));
+    std::uniform_int_distribution<size_t> wordNumber(0, wordsCount - 1);
+    std::vector<std::string> queries(queriesCount);
+    for (size_t queryNumber = 0; queryNumber < queriesCount; ++queryNumber)
+    {
+        queries[queryNumber] = queryNumber % 2 == 0 ? words[wordNumber(random)] : makeWord(random);
+    }
+    const std::vector<std::string_view> queryViews(queries.begin(), queries.end());
+
+    auto lookUpOneByOne = [&]()
+    {
+        size_t found = 0;
+        for (const std::string &query : queries)
+        {
+            found += dictionary.isValidWord(query) ? 1 : 0;
+        }
+        return found;
+    };
+    auto lookUpInBatches = [&]()
+    {
+        size_t found = 0;
+        std::array<bool, BATCH_SIZE> results{};
+        for (size_t first = 0; first < queryViews.size(); first += BATCH_SIZE)
+        {
+            const size_t batchSize = std::min(BATCH_SIZE, queryViews.size() - first);
+            dictionary.areValidWords(std::span(queryViews).subspan(first, batchSize), std::span(results).first(batchSize));
+            found += static_cast<size_t>(std::ranges::count(std::span(results).first(batchSize), true));
+        }
+        return found;
+    };
+
+    size_t foundOneByOne = 0;
+    size_t foundInBatches = 0;
+    const double oneByOneNs = measure(lookUpOneByOne, queriesCount, foundOneByOne);
+    const double inBatchesNs = measure(lookUpInBatches, queriesCount, foundInBatches);
+    if (foundOneByOne != foundInBatches)
+    {
+        throw std::runtime_error(std::format("{} words: isValidWord and areValidWords disagree", wordsCount));
+    }
+
+    std::cout << std::format("{:>9} words  load {:8.1f} ms  {:7.1f} MiB  isValidWord {:6.1f} ns  "
+                             "areValidWords {:6.1f} ns  found {:.1f}%\n",
+                             wordsCount, loadMs, static_cast<double>(dictionary.getMemoryUsage()) / (1024.0 * 1024.0),
+                             oneByOneNs, inBatchesNs, 100.0 * static_cast<double>(foundOneByOne) / static_cast<double>(queriesCount));
+    std::filesystem::remove(paths.allowed);
+}
+
+int main(int argc, char *argv[])
+{
+    BenchmarkOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "DictionaryBenchmark: " << e.what() << "\n"
+                  << "usage: DictionaryBenchmark [max words count] [queries count]\n";
+        return 1;
+    }
+
+    try
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "DictionaryBenchmark";
+        std::filesystem::create_directories(directory);
+
+        // smaller lists are prefixes of the largest one, generated once
+        std::mt19937 random(1);
+        std::vector<std::string> allWords(options.maxWordsCount);
+        for (std::string &word : allWords)
+        {
+            word = makeWord(random);
+        }
+
+        for (size_t wordsCount = MIN_WORDS_COUNT; wordsCount <= options.maxWordsCount; wordsCount *= 10)
+        {
+            benchmarkSize(directory, allWords, wordsCount, options.queriesCount);
+        }
+        std::filesystem::remove(directory);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "DictionaryBenchmark: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
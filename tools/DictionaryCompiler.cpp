@@ -0,0 +1,227 @@
+// Compiles a text word list (one word per line) into the binary format read by MappedDictionary,
+// or embeds several word lists into a C++ source fragment read by EmbeddedDictionary.
+//
+// usage: DictionaryCompiler <input.txt> <output.bin>
+//        DictionaryCompiler --embed <output.inc> <{LANG}_DICTIONARY_{N}L.txt>...
+
+#include "../src/Model/Dictionary/CompiledDictionaryFormat.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static size_t countUnicodeCharacters(const std::string &utf8_string)
+{
+    size_t count = 0;
+    for (char c : utf8_string)
+    {
+        if ((static_cast<unsigned char>(c) & 0xC0) != 0x80)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+static std::vector<std::string> readWords(const std::filesystem::path &inputPath)
+{
+    std::ifstream inputFile(inputPath, std::ios::binary);
+    if (!inputFile.is_open())
+    {
+        throw std::runtime_error("cannot open " + inputPath.string());
+    }
+
+    std::vector<std::string> words;
+    std::string line;
+    while (std::getline(inputFile, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (!line.empty())
+        {
+            words.push_back(line);
+        }
+    }
+    return words;
+}
+
+template <typename T>
+static void writeAt(std::vector<char> &output, std::uint64_t position, const T &value)
+{
+    const auto *bytes = reinterpret_cast<const char *>(&value);
+    std::copy(bytes, bytes + sizeof(T), output.begin() + static_cast<std::ptrdiff_t>(position));
+}
+
+static std::vector<char> compile(const std::vector<std::string> &words)
+{
+    if (words.empty())
+    {
+        throw std::runtime_error("word list is empty");
+    }
+
+    CompiledDictionaryHeader header{};
+    header.magic = CompiledDictionaryHeader::MAGIC;
+    header.version = CompiledDictionaryHeader::VERSION;
+    header.wordLength = static_cast<std::uint32_t>(countUnicodeCharacters(words.front()));
+    header.wordsCount = static_cast<std::uint32_t>(words.size());
+    header.indexSize = CompiledDictionaryFormat::indexSizeFor(header.wordsCount);
+
+    std::vector<std::uint32_t> offsets;
+    offsets.reserve(words.size() + 1);
+    std::uint32_t wordsSize = 0;
+    for (const std::string &word : words)
+    {
+        if (countUnicodeCharacters(word) != header.wordLength)
+        {
+            throw std::runtime_error("word of unexpected length: " + word);
+        }
+        offsets.push_back(wordsSize);
+        wordsSize += static_cast<std::uint32_t>(word.size());
+    }
+    offsets.push_back(wordsSize);
+
+    std::vector<std::uint32_t> index(header.indexSize, CompiledDictionaryFormat::EMPTY_SLOT);
+    const std::uint32_t mask = header.indexSize - 1;
+    for (std::uint32_t wordNumber = 0; wordNumber < header.wordsCount; ++wordNumber)
+    {
+        auto slot = static_cast<std::uint32_t>(CompiledDictionaryFormat::hash(words[wordNumber])) & mask;
+        bool isDuplicate = false;
+        while (index[slot] != CompiledDictionaryFormat::EMPTY_SLOT)
+        {
+            if (words[index[slot] - 1] == words[wordNumber])
+            {
+                isDuplicate = true;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+        if (!isDuplicate)
+        {
+            index[slot] = wordNumber + 1;
+        }
+    }
+
+    header.offsetsPosition = CompiledDictionaryFormat::align(sizeof(CompiledDictionaryHeader));
+    header.indexPosition = CompiledDictionaryFormat::align(header.offsetsPosition + (offsets.size() * sizeof(std::uint32_t)));
+    header.wordsPosition = CompiledDictionaryFormat::align(header.indexPosition + (index.size() * sizeof(std::uint32_t)));
+    header.wordsSize = wordsSize;
+
+    std::vector<char> output(header.wordsPosition + header.wordsSize, 0);
+    writeAt(output, 0, header);
+    for (size_t i = 0; i < offsets.size(); ++i)
+    {
+        writeAt(output, header.offsetsPosition + (i * sizeof(std::uint32_t)), offsets[i]);
+    }
+    for (size_t i = 0; i < index.size(); ++i)
+    {
+        writeAt(output, header.indexPosition + (i * sizeof(std::uint32_t)), index[i]);
+    }
+    auto wordsOutput = output.begin() + static_cast<std::ptrdiff_t>(header.wordsPosition);
+    for (const std::string &word : words)
+    {
+        wordsOutput = std::copy(word.begin(), word.end(), wordsOutput);
+    }
+
+    return output;
+}
+
+static void embed(const std::filesystem::path &outputPath, const std::vector<std::filesystem::path> &inputPaths)
+{
+    const std::regex dictionaryName("([A-Z]+)_DICTIONARY_([0-9]+)L");
+
+    std::ofstream outputFile(outputPath, std::ios::binary | std::ios::trunc);
+    outputFile << "// generated by DictionaryCompiler --embed, do not edit\n\n";
+
+    std::string wordListsMacro = "#define WORDLE_EMBEDDED_WORD_LISTS(X)";
+    for (const std::filesystem::path &inputPath : inputPaths)
+    {
+        const std::string name = inputPath.stem().string();
+        std::smatch match;
+        if (!std::regex_match(name, match, dictionaryName))
+        {
+            throw std::runtime_error("unexpected dictionary name " + name);
+        }
+
+        // perfect hash needs unique keys
+        std::vector<std::string> words = readWords(inputPath);
+        std::ranges::sort(words);
+        words.erase(std::ranges::unique(words).begin(), words.end());
+        if (words.empty())
+        {
+            continue;
+        }
+
+        outputFile << "constexpr std::string_view " << name << "[] = {\n";
+        for (const std::string &word : words)
+        {
+            outputFile << "    \"";
+            for (char chr : word)
+            {
+                if (chr == '"' || chr == '\\')
+                {
+                    outputFile << '\\';
+                }
+                outputFile << chr;
+            }
+            outputFile << "\",\n";
+        }
+        outputFile << "};\n\n";
+
+        wordListsMacro += " \\\n    X(" + match[1].str() + ", " + match[2].str() + ", " + name + ")";
+    }
+    outputFile << wordListsMacro << "\n";
+
+    if (!outputFile)
+    {
+        throw std::runtime_error("cannot write " + outputPath.string());
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc >= 3 && std::string(argv[1]) == "--embed")
+    {
+        try
+        {
+            embed(argv[2], std::vector<std::filesystem::path>(argv + 3, argv + argc));
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "DictionaryCompiler: " << e.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (argc != 3)
+    {
+        std::cerr << "usage: DictionaryCompiler <input.txt> <output.bin>\n"
+                  << "       DictionaryCompiler --embed <output.inc> <{LANG}_DICTIONARY_{N}L.txt>...\n";
+        return 1;
+    }
+
+    try
+    {
+        const std::vector<char> output = compile(readWords(argv[1]));
+
+        std::ofstream outputFile(argv[2], std::ios::binary | std::ios::trunc);
+        outputFile.write(output.data(), static_cast<std::streamsize>(output.size()));
+        if (!outputFile)
+        {
+            throw std::runtime_error(std::string("cannot write ") + argv[2]);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "DictionaryCompiler: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
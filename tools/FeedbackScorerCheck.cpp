@@ -0,0 +1,292 @@
+// Checks the feedback scorers against the map-based scoring WordleModel used before them, and
+// that scoring a guess does not touch the heap.
+// Differential part: random guess and target pairs of every length from 1 to
+// FeedbackScorer::MAX_WORD_LENGTH over small alphabets, so repeated letters are common. The
+// reference keeps letter counts in a std::map keyed by the letter text, as the old
+// checkInputWord did. FeedbackScorer::score, the scorer compiled for the length and GuessScorer
+// must give the same feedback and pattern code.
+// Allocation part: every scorer runs over a word list under a counting operator new.
+//
+// usage: FeedbackScorerCheck [pairs count] [seed]
+//   pairs count  random pairs per word length (default 20000)
+//   seed         seed of the random words (default 1)
+//
+// prints the mismatches and the allocations per scorer, exits with 1 if there is any
+
+#include "../src/Model/Solver/FeedbackScorer.hpp"
+#include "../src/Model/Solver/GuessScorer.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <new>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static std::atomic<std::uint64_t> allocationsCount = 0;
+
+void *operator new(std::size_t size)
+{
+    allocationsCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+static constexpr int MIN_LETTERS_COUNT = 2;
+static constexpr int MAX_LETTERS_COUNT = 7;
+static constexpr size_t ALLOCATION_WORDS_COUNT = 20000;
+
+using Feedback = FeedbackScorer::Feedback;
+using Word = std::vector<std::uint8_t>;
+
+struct CheckOptions
+{
+    size_t pairsCount = 20000;
+    std::uint32_t seed = 1;
+};
+
+static CheckOptions parseOptions(int argc, char *argv[])
+{
+    CheckOptions options;
+    if (argc > 3)
+    {
+        throw std::invalid_argument("too many arguments");
+    }
+    if (argc > 1)
+    {
+        options.pairsCount = std::stoul(argv[1]);
+    }
+    if (argc > 2)
+    {
+        options.seed = static_cast<std::uint32_t>(std::stoul(argv[2]));
+    }
+    if (options.pairsCount == 0)
+    {
+        throw std::invalid_argument("pairs count must be positive");
+    }
+    return options;
+}
+
+// the scoring of WordleModel::checkInputWord before FeedbackScorer, letters as text
+static std::vector<Feedback> scoreWithMap(const std::vector<std::string> &guess, const std::vector<std::string> &target)
+{
+    std::vector<Feedback> feedback(guess.size(), Feedback::ABSENT);
+    std::map<std::string, int> targetLetterCounts;
+    for (const std::string &letter : target)
+    {
+        targetLetterCounts[letter]++;
+    }
+
+    for (size_t letterIndex = 0; letterIndex < guess.size(); ++letterIndex)
+    {
+        if (guess[letterIndex] == target[letterIndex])
+        {
+            feedback[letterIndex] = Feedback::CORRECT;
+            targetLetterCounts[guess[letterIndex]]--;
+        }
+    }
+    for (size_t letterIndex = 0; letterIndex < guess.size(); ++letterIndex)
+    {
+        if (feedback[letterIndex] == Feedback::CORRECT)
+        {
+            continue;
+        }
+        const std::string &currentLetter = guess[letterIndex];
+        if (targetLetterCounts.contains(currentLetter) && targetLetterCounts[currentLetter] > 0)
+        {
+            feedback[letterIndex] = Feedback::PRESENT;
+            targetLetterCounts[currentLetter]--;
+        }
+    }
+    return feedback;
+}
+
+static std::vector<std::string> toText(const Word &word)
+{
+    std::vector<std::string> letters;
+    for (std::uint8_t letter : word)
+    {
+        // two-byte letters, as Cyrillic ones are in UTF-8
+        letters.push_back(std::string{static_cast<char>(0xD0), static_cast<char>(0x90 + letter)});
+    }
+    return letters;
+}
+
+static FeedbackScorer::PatternCode toPatternCode(const std::vector<Feedback> &feedback)
+{
+    FeedbackScorer::PatternCode code = 0;
+    for (size_t i = 0; i < feedback.size(); ++i)
+    {
+        code += static_cast<FeedbackScorer::PatternCode>(feedback[i]) * FeedbackScorer::digitWeight(static_cast<int>(i));
+    }
+    return code;
+}
+
+static Word makeWord(std::mt19937 &random, int wordLength, int lettersCount)
+{
+    std::uniform_int_distribution<int> letter(0, lettersCount - 1);
+    Word word(wordLength);
+    for (std::uint8_t &wordLetter : word)
+    {
+        wordLetter = static_cast<std::uint8_t>(letter(random));
+    }
+    return word;
+}
+
+// number of pairs some scorer disagrees on with the reference
+static size_t checkLength(const CheckOptions &options, int wordLength)
+{
+    std::mt19937 random(options.seed + wordLength);
+    std::uniform_int_distribution<int> lettersCountDistribution(MIN_LETTERS_COUNT, MAX_LETTERS_COUNT);
+    const FeedbackScorer::ScoreFunction scoreFixed = FeedbackScorer::getScoreFunction(wordLength);
+
+    size_t mismatchesCount = 0;
+    for (size_t pairNumber = 0; pairNumber < options.pairsCount; ++pairNumber)
+    {
+        const int lettersCount = lettersCountDistribution(random);
+        const Word guess = makeWord(random, wordLength, lettersCount);
+        const Word target = makeWord(random, wordLength, lettersCount);
+
+        const std::vector<Feedback> expected = scoreWithMap(toText(guess), toText(target));
+        const FeedbackScorer::PatternCode expectedCode = toPatternCode(expected);
+
+        std::vector<Feedback> feedback(wordLength);
+        bool isMatching = FeedbackScorer::score(guess, target, feedback) == expectedCode && feedback == expected;
+        if (scoreFixed != nullptr)
+        {
+            std::vector<Feedback> fixedFeedback(wordLength);
+            isMatching = isMatching && scoreFixed(guess.data(), target.data(), fixedFeedback.data()) == expectedCode &&
+                         fixedFeedback == expected;
+        }
+        isMatching = isMatching && GuessScorer(guess).score(target.data()) == expectedCode;
+
+        if (!isMatching)
+        {
+            if (mismatchesCount == 0)
+            {
+                std::cout << std::format("{:>2}L  first mismatch at pair {}\n", wordLength, pairNumber);
+            }
+            mismatchesCount++;
+        }
+    }
+    return mismatchesCount;
+}
+
+// allocations made while the list is scored, every word as the guess against its successor
+static std::uint64_t countAllocations(const std::string &name, int wordLength, const std::function<std::uint64_t()> &scoreAll)
+{
+    const std::uint64_t allocationsBefore = allocationsCount.load();
+    const auto startTime = std::chrono::steady_clock::now();
+    const std::uint64_t checksum = scoreAll();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    const std::uint64_t allocations = allocationsCount.load() - allocationsBefore;
+
+    std::cout << std::format("{:<15} {:>2}L  {:7.2f} ns per score  {} allocations  (checksum {})\n", name, wordLength,
+                             seconds * 1e9 / (ALLOCATION_WORDS_COUNT - 1), allocations, checksum);
+    return allocations;
+}
+
+static std::uint64_t checkAllocations(int wordLength)
+{
+    std::mt19937 random(wordLength);
+    std::vector<std::uint8_t> wordLetters;
+    for (size_t wordNumber = 0; wordNumber < ALLOCATION_WORDS_COUNT; ++wordNumber)
+    {
+        const Word word = makeWord(random, wordLength, MAX_LETTERS_COUNT);
+        wordLetters.insert(wordLetters.end(), word.begin(), word.end());
+    }
+    const FeedbackScorer::ScoreFunction scoreFixed = FeedbackScorer::getScoreFunction(wordLength);
+
+    auto scoreGeneric = [&]()
+    {
+        std::uint64_t checksum = 0;
+        std::array<Feedback, FeedbackScorer::MAX_WORD_LENGTH> feedback{};
+        for (size_t n = 0; n + 1 < ALLOCATION_WORDS_COUNT; ++n)
+        {
+            const std::span<const std::uint8_t> guess(wordLetters.data() + (n * wordLength), wordLength);
+            const std::span<const std::uint8_t> target(wordLetters.data() + ((n + 1) * wordLength), wordLength);
+            checksum += FeedbackScorer::score(guess, target, std::span(feedback).first(wordLength));
+        }
+        return checksum;
+    };
+    auto scoreSpecialized = [&]()
+    {
+        std::uint64_t checksum = 0;
+        std::array<Feedback, FeedbackScorer::MAX_WORD_LENGTH> feedback{};
+        for (size_t n = 0; n + 1 < ALLOCATION_WORDS_COUNT; ++n)
+        {
+            checksum += scoreFixed(wordLetters.data() + (n * wordLength), wordLetters.data() + ((n + 1) * wordLength),
+                                   feedback.data());
+        }
+        return checksum;
+    };
+    auto scoreWithGuessScorer = [&]()
+    {
+        std::uint64_t checksum = 0;
+        for (size_t n = 0; n + 1 < ALLOCATION_WORDS_COUNT; ++n)
+        {
+            const GuessScorer scorer(std::span<const std::uint8_t>(wordLetters.data() + (n * wordLength), wordLength));
+            checksum += scorer.score(wordLetters.data() + ((n + 1) * wordLength));
+        }
+        return checksum;
+    };
+
+    std::uint64_t allocations = countAllocations("FeedbackScorer", wordLength, scoreGeneric);
+    if (scoreFixed != nullptr)
+    {
+        allocations += countAllocations("scoreFixed", wordLength, scoreSpecialized);
+    }
+    allocations += countAllocations("GuessScorer", wordLength, scoreWithGuessScorer);
+    return allocations;
+}
+
+int main(int argc, char *argv[])
+{
+    CheckOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FeedbackScorerCheck: " << e.what() << "\n"
+                  << "usage: FeedbackScorerCheck [pairs count] [seed]\n";
+        return 1;
+    }
+
+    size_t mismatchesCount = 0;
+    std::uint64_t allocations = 0;
+    for (int wordLength = 1; wordLength <= FeedbackScorer::MAX_WORD_LENGTH; ++wordLength)
+    {
+        mismatchesCount += checkLength(options, wordLength);
+    }
+    for (int wordLength = FeedbackScorer::MIN_FIXED_LENGTH; wordLength <= FeedbackScorer::MAX_FIXED_LENGTH; ++wordLength)
+    {
+        allocations += checkAllocations(wordLength);
+    }
+
+    std::cout << std::format("{} mismatches in {} pairs, {} allocations while scoring\n", mismatchesCount,
+                             options.pairsCount * FeedbackScorer::MAX_WORD_LENGTH, allocations);
+    return mismatchesCount == 0 && allocations == 0 ? 0 : 1;
+}
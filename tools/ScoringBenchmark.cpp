@@ -0,0 +1,191 @@
+// Compares feedback scoring compiled for a word length with the generic loops on the runtime
+// length: FeedbackScorer (one guess against one target, as in the game) for every length with a
+// fixed scorer, and BatchScorer (one guess against the whole list, as for the pattern matrix) for
+// the lengths it supports. Words are random over a 33-letter alphabet, the seed is fixed.
+//
+// usage: ScoringBenchmark [words count] [rounds]
+//   words count  words in the list (default 20000)
+//   rounds       passes over the list per measurement (default 20)
+//
+// prints the time per scored pair of both paths and the speedup, and checks they agree
+
+#include "../src/Model/Solver/BatchScorer.hpp"
+#include "../src/Model/Solver/FeedbackScorer.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static constexpr int LETTERS_COUNT = 33;
+
+struct BenchmarkOptions
+{
+    size_t wordsCount = 20000;
+    int roundsCount = 20;
+};
+
+static BenchmarkOptions parseOptions(int argc, char *argv[])
+{
+    BenchmarkOptions options;
+    if (argc > 3)
+    {
+        throw std::invalid_argument("too many arguments");
+    }
+    if (argc > 1)
+    {
+        options.wordsCount = std::stoul(argv[1]);
+    }
+    if (argc > 2)
+    {
+        options.roundsCount = std::stoi(argv[2]);
+    }
+    if (options.wordsCount < 2 || options.roundsCount < 1)
+    {
+        throw std::invalid_argument("words count and rounds must be positive");
+    }
+    return options;
+}
+
+static std::vector<std::uint8_t> makeWords(size_t wordsCount, int wordLength)
+{
+    std::mt19937 random(wordLength);
+    std::uniform_int_distribution<int> letter(0, LETTERS_COUNT - 1);
+    std::vector<std::uint8_t> wordLetters(wordsCount * wordLength);
+    for (std::uint8_t &wordLetter : wordLetters)
+    {
+        wordLetter = static_cast<std::uint8_t>(letter(random));
+    }
+    return wordLetters;
+}
+
+// nanoseconds per call of score, which runs one pass and returns a checksum of the codes
+template <typename Score>
+static double measure(const Score &score, const BenchmarkOptions &options, size_t pairsPerPass, std::uint64_t &checksum)
+{
+    checksum = score(); // warms the caches and the branch predictors
+    const auto startTime = std::chrono::steady_clock::now();
+    for (int round = 0; round < options.roundsCount; ++round)
+    {
+        checksum += score();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return seconds * 1e9 / (static_cast<double>(pairsPerPass) * options.roundsCount);
+}
+
+static void printResult(const std::string &name, int wordLength, double genericNs, double specializedNs,
+                        std::uint64_t genericChecksum, std::uint64_t specializedChecksum)
+{
+    if (genericChecksum != specializedChecksum)
+    {
+        throw std::runtime_error(std::format("{} {}L: the paths give different codes", name, wordLength));
+    }
+    std::cout << std::format("{:<15} {:>2}L  generic {:7.2f} ns  specialized {:7.2f} ns  x{:.2f}\n",
+                             name, wordLength, genericNs, specializedNs, genericNs / specializedNs);
+}
+
+// every word against its successor in the list
+static void benchmarkFeedbackScorer(const BenchmarkOptions &options, int wordLength)
+{
+    const std::vector<std::uint8_t> wordLetters = makeWords(options.wordsCount, wordLength);
+    const size_t pairsCount = options.wordsCount - 1;
+    const FeedbackScorer::ScoreFunction scoreFixed = FeedbackScorer::getScoreFunction(wordLength);
+
+    auto scoreGeneric = [&]()
+    {
+        std::uint64_t checksum = 0;
+        std::array<FeedbackScorer::Feedback, FeedbackScorer::MAX_WORD_LENGTH> feedback{};
+        for (size_t n = 0; n < pairsCount; ++n)
+        {
+            const std::span<const std::uint8_t> guess(wordLetters.data() + (n * wordLength), wordLength);
+            const std::span<const std::uint8_t> target(wordLetters.data() + ((n + 1) * wordLength), wordLength);
+            checksum += FeedbackScorer::score(guess, target, std::span(feedback).first(wordLength));
+        }
+        return checksum;
+    };
+    auto scoreSpecialized = [&]()
+    {
+        std::uint64_t checksum = 0;
+        std::array<FeedbackScorer::Feedback, FeedbackScorer::MAX_WORD_LENGTH> feedback{};
+        for (size_t n = 0; n < pairsCount; ++n)
+        {
+            checksum += scoreFixed(wordLetters.data() + (n * wordLength), wordLetters.data() + ((n + 1) * wordLength),
+                                   feedback.data());
+        }
+        return checksum;
+    };
+
+    std::uint64_t genericChecksum = 0;
+    std::uint64_t specializedChecksum = 0;
+    const double genericNs = measure(scoreGeneric, options, pairsCount, genericChecksum);
+    const double specializedNs = measure(scoreSpecialized, options, pairsCount, specializedChecksum);
+    printResult("FeedbackScorer", wordLength, genericNs, specializedNs, genericChecksum, specializedChecksum);
+}
+
+// the first words of the list as guesses against the whole list
+static void benchmarkBatchScorer(const BenchmarkOptions &options, int wordLength)
+{
+    constexpr size_t GUESSES_COUNT = 64;
+    const std::vector<std::uint8_t> wordLetters = makeWords(options.wordsCount, wordLength);
+    BatchScorer generic(wordLetters, wordLength, false);
+    BatchScorer specialized(wordLetters, wordLength);
+
+    auto scoreWith = [&](BatchScorer &scorer)
+    {
+        std::uint64_t checksum = 0;
+        for (size_t guessNumber = 0; guessNumber < GUESSES_COUNT; ++guessNumber)
+        {
+            const std::span<const std::uint8_t> patterns = scorer.scoreAgainstAll(guessNumber % options.wordsCount);
+            for (size_t n = 0; n < patterns.size(); n += 97)
+            {
+                checksum += patterns[n] * (n + 1);
+            }
+        }
+        return checksum;
+    };
+
+    const size_t pairsPerPass = GUESSES_COUNT * options.wordsCount;
+    std::uint64_t genericChecksum = 0;
+    std::uint64_t specializedChecksum = 0;
+    const double genericNs = measure([&]() { return scoreWith(generic); }, options, pairsPerPass, genericChecksum);
+    const double specializedNs = measure([&]() { return scoreWith(specialized); }, options, pairsPerPass, specializedChecksum);
+    printResult("BatchScorer", wordLength, genericNs, specializedNs, genericChecksum, specializedChecksum);
+}
+
+int main(int argc, char *argv[])
+{
+    BenchmarkOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "ScoringBenchmark: " << e.what() << "\n"
+                  << "usage: ScoringBenchmark [words count] [rounds]\n";
+        return 1;
+    }
+
+    try
+    {
+        for (int wordLength = FeedbackScorer::MIN_FIXED_LENGTH; wordLength <= FeedbackScorer::MAX_FIXED_LENGTH; ++wordLength)
+        {
+            benchmarkFeedbackScorer(options, wordLength);
+        }
+        for (int wordLength = FeedbackScorer::MIN_FIXED_LENGTH; BatchScorer::isSupportedLength(wordLength); ++wordLength)
+        {
+            benchmarkBatchScorer(options, wordLength);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "ScoringBenchmark: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}